@@ -1,7 +1,10 @@
 // Example Windjammer Plugin in C++
 // Demonstrates the C FFI plugin interface with C++ features
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <type_traits>
 #include <string>
 #include <vector>
 #include <memory>
@@ -58,6 +61,138 @@ struct WjPluginDependency {
     const char* version;
 };
 
+// Entity identifier (opaque to plugins)
+typedef uint64_t WjEntityId;
+
+// A contiguous range of entities assigned to this plugin for the frame
+struct WjEntityRange {
+    const WjEntityId* entities;  // dense array of entity ids
+    size_t count;
+};
+
+// Opaque command buffer: plugins record engine mutations here during
+// update; the engine applies them after all plugins have run
+struct WjCommandBuffer;
+
+// Component type identifier (assigned by the engine at registration)
+typedef uint32_t WjComponentTypeId;
+
+// Well-known component types registered by the engine core
+enum WjCoreComponent {
+    WJ_COMPONENT_TRANSFORM = 1,
+    WJ_COMPONENT_VELOCITY = 2,
+};
+
+// Direct view over an engine-owned component array. The plugin iterates
+// engine memory in place — no copies cross the boundary. The view is
+// valid for the current frame; if the engine relocates storage it bumps
+// the generation, and stale views must be re-acquired.
+struct WjComponentView {
+    void* data;           // base pointer into engine storage
+    size_t stride;        // bytes between consecutive elements
+    size_t count;         // number of live elements
+    uint32_t generation;  // bumped when the engine relocates storage
+};
+
+// Acquire a read/write view over a component array (resolved from the
+// host binary by the dynamic loader). Pass writable=false for read-only
+// access so the engine can skip change tracking.
+WjPluginErrorCode wj_app_component_view(WjApp* app, WjComponentTypeId type,
+                                        bool writable, WjComponentView* out_view);
+
+// Frame-scoped arena owned by WjApp. Allocation is a pointer bump with
+// no per-allocation bookkeeping; the engine resets the arena between
+// frames, freeing everything at once. Plugins should route transient
+// per-frame data here instead of fighting the global allocator.
+struct WjArena;
+
+// The calling plugin's per-frame arena (one per plugin, reset by the
+// engine after wj_plugin_update returns)
+WjArena* wj_app_frame_arena(WjApp* app);
+
+// Bump-allocate size bytes with the given alignment. Returns NULL only
+// if the arena is exhausted. Never freed individually.
+void* wj_arena_alloc(WjArena* arena, size_t size, size_t align);
+
+// Discard everything allocated since the last reset. Plugins normally
+// never call this — the engine resets at the frame boundary.
+void wj_arena_reset(WjArena* arena);
+
+// Fixed-size event record pushed from the plugin to the engine. POD so
+// batches can be drained with memcpy; 32 bytes, two inline payload words.
+struct WjEvent {
+    uint32_t type;        // plugin-defined event type
+    uint32_t flags;
+    uint64_t subject;     // typically an entity or asset id
+    uint64_t payload[2];  // inline payload, no indirection
+};
+
+// Single-producer single-consumer ring buffer between this plugin
+// (producer) and the engine (consumer). Lock-free: pushes are a store
+// plus a release write of the head index, and the engine drains whole
+// batches on its side. No mutex, no per-event allocation.
+struct WjEventQueue;
+
+// Create this plugin's outbound event queue. Call once from
+// wj_plugin_init; capacity is rounded up to a power of two. The engine
+// owns the storage and destroys it at plugin unload.
+WjEventQueue* wj_app_event_queue_create(WjApp* app, size_t capacity);
+
+// Push one event. Returns false if the ring is full (the event is
+// dropped — size the queue for your worst-case frame).
+bool wj_event_push(WjEventQueue* queue, const WjEvent* event);
+
+// Push a contiguous batch; returns how many were actually enqueued.
+size_t wj_event_push_batch(WjEventQueue* queue, const WjEvent* events, size_t count);
+
+// Hot-reload snapshot protocol. Before unloading a library the engine
+// calls wj_plugin_snapshot; after loading the replacement it calls
+// wj_plugin_restore with the same bytes. The blob must be trivially
+// copyable — entity ids and offsets, never pointers into plugin memory —
+// so a reload is a single memcpy instead of a serialize/parse round trip.
+//
+// Call protocol: the engine first calls snapshot with buffer=NULL to
+// query the size, then again with an engine-owned buffer of that size.
+
+// One frame's worth of work, handed to the plugin in a single FFI call.
+// Batching the whole frame avoids a boundary crossing per entity/event.
+struct WjFrameBatch {
+    float delta_time;             // seconds since the previous update
+    uint64_t frame_number;        // monotonically increasing frame index
+    const WjEntityRange* ranges;  // entity ranges assigned to this plugin
+    size_t range_count;
+    WjCommandBuffer* commands;    // deferred engine mutations
+};
+
+// Versioned plugin function table. The engine resolves a single
+// wj_plugin_entry symbol per plugin instead of one dlsym per entry
+// point, and the whole table fits in one cache line. New entry points
+// are appended and gated on abi_version; unused slots may be NULL.
+#define WJ_PLUGIN_ABI_VERSION 1
+
+// Capability flags for WjPluginVTable.flags
+enum {
+    // init/cleanup touch no shared state; the loader may run them
+    // concurrently with other plugins' init
+    WJ_PLUGIN_FLAG_THREADSAFE_INIT = 1u << 0,
+};
+
+struct WjPluginVTable {
+    uint32_t abi_version;  // WJ_PLUGIN_ABI_VERSION the plugin was built with
+    uint32_t flags;        // WJ_PLUGIN_FLAG_* capability bits
+    WjPluginInfo (*info)(void);
+    const WjPluginDependency* (*dependencies)(size_t* out_count);
+    WjPluginErrorCode (*init)(WjApp* app);
+    WjPluginErrorCode (*update)(WjApp* app, const WjFrameBatch* batch);
+    WjPluginErrorCode (*snapshot)(WjApp* app, void* buffer, size_t* size);
+    WjPluginErrorCode (*restore)(WjApp* app, const void* buffer, size_t size);
+    WjPluginErrorCode (*cleanup)(WjApp* app);
+};
+
+// The one symbol the engine looks up by name. The returned table must
+// have static storage duration.
+const WjPluginVTable* wj_plugin_entry(void);
+
 // ============================================================================
 // Plugin Implementation (C++ with RAII)
 // ============================================================================
@@ -73,15 +208,92 @@ public:
         std::cout << "[ExamplePlugin++] State destroyed" << std::endl;
     }
     
-    void initialize() {
+    void initialize(WjApp* app) {
         std::cout << "[ExamplePlugin++] Initializing C++ plugin..." << std::endl;
-        // Add your initialization logic here
+        // Outbound event queue: sized for a worst-case frame, created
+        // once here, pushed to lock-free from update()
+        events_ = wj_app_event_queue_create(app, 4096);
     }
     
     void cleanup() {
         std::cout << "[ExamplePlugin++] Cleaning up C++ plugin..." << std::endl;
         // Add your cleanup logic here
     }
+
+    void update(WjApp* app, const WjFrameBatch* batch) {
+        // Process the whole frame's entities in one pass — no per-entity
+        // FFI calls. A physics plugin would integrate velocities here.
+        size_t total = 0;
+        for (size_t i = 0; i < batch->range_count; i++) {
+            total += batch->ranges[i].count;
+        }
+        entities_processed_ += total;
+
+        // Transient per-frame scratch comes from the engine's frame
+        // arena — pointer-bump allocation, freed wholesale at the frame
+        // boundary, no malloc contention with other plugins.
+        WjArena* arena = wj_app_frame_arena(app);
+        WjEntityId* scratch = static_cast<WjEntityId*>(
+            wj_arena_alloc(arena, total * sizeof(WjEntityId), alignof(WjEntityId)));
+        if (scratch) {
+            size_t n = 0;
+            for (size_t i = 0; i < batch->range_count; i++) {
+                for (size_t j = 0; j < batch->ranges[i].count; j++) {
+                    scratch[n++] = batch->ranges[i].entities[j];
+                }
+            }
+        }
+
+        // Iterate transforms in place through a zero-copy view over
+        // engine-owned storage (layout matches the engine's Transform).
+        struct Transform {
+            float x, y, z;
+        };
+        WjComponentView transforms;
+        if (wj_app_component_view(app, WJ_COMPONENT_TRANSFORM, true, &transforms) == WJ_OK) {
+            char* base = static_cast<char*>(transforms.data);
+            for (size_t i = 0; i < transforms.count; i++) {
+                Transform* t = reinterpret_cast<Transform*>(base + i * transforms.stride);
+                t->y -= 9.81f * batch->delta_time;  // toy gravity
+            }
+        }
+
+        // Report frame results to the engine: one lock-free push, no
+        // allocation, drained by the engine in a batch
+        if (events_) {
+            WjEvent ev = {};
+            ev.type = 1;  // plugin-defined: "frame processed"
+            ev.subject = batch->frame_number;
+            ev.payload[0] = total;
+            wj_event_push(events_, &ev);
+        }
+    }
+
+    // Everything worth carrying across a hot reload, as one trivially
+    // copyable struct. No pointers — ids and counters only.
+    struct Snapshot {
+        uint32_t version;  // bump when the layout changes
+        uint64_t entities_processed;
+    };
+    static_assert(std::is_trivially_copyable<Snapshot>::value,
+                  "hot-reload snapshots must be memcpy-able");
+
+    Snapshot snapshot() const {
+        Snapshot s = {};
+        s.version = 1;
+        s.entities_processed = entities_processed_;
+        return s;
+    }
+
+    void restore(const Snapshot& s) {
+        if (s.version == 1) {
+            entities_processed_ = s.entities_processed;
+        }
+    }
+
+private:
+    uint64_t entities_processed_ = 0;
+    WjEventQueue* events_ = nullptr;  // engine-owned, valid until unload
 };
 
 // Global plugin state (managed by C++)
@@ -128,7 +340,7 @@ WjPluginErrorCode wj_plugin_init(WjApp* app) {
         
         // Create plugin state (RAII)
         g_plugin_state = std::make_unique<PluginState>();
-        g_plugin_state->initialize();
+        g_plugin_state->initialize(app);
         
         std::cout << "[ExamplePlugin++] Initialized successfully!" << std::endl;
         return WJ_OK;
@@ -138,6 +350,57 @@ WjPluginErrorCode wj_plugin_init(WjApp* app) {
     }
 }
 
+// Per-frame update: called once per frame with a batched description of
+// the plugin's work (entity ranges, delta time, command buffer). This is
+// a hot path — no allocation, no logging, no exceptions escaping.
+#ifdef _WIN32
+__declspec(dllexport)
+#endif
+WjPluginErrorCode wj_plugin_update(WjApp* app, const WjFrameBatch* batch) {
+    if (!app || !batch) {
+        return WJ_INVALID_PARAMETER;
+    }
+    g_plugin_state->update(app, batch);
+    return WJ_OK;
+}
+
+// Hot-reload snapshot: write state into the engine-owned buffer as a
+// trivially-copyable blob (size query when buffer is NULL)
+#ifdef _WIN32
+__declspec(dllexport)
+#endif
+WjPluginErrorCode wj_plugin_snapshot(WjApp* app, void* buffer, size_t* size) {
+    if (!app || !size) {
+        return WJ_INVALID_PARAMETER;
+    }
+    if (!buffer) {
+        *size = sizeof(PluginState::Snapshot);
+        return WJ_OK;
+    }
+    if (*size < sizeof(PluginState::Snapshot)) {
+        return WJ_INVALID_PARAMETER;
+    }
+    PluginState::Snapshot s = g_plugin_state->snapshot();
+    std::memcpy(buffer, &s, sizeof(s));
+    *size = sizeof(s);
+    return WJ_OK;
+}
+
+// Hot-reload restore: called on the freshly loaded library with the
+// bytes the old one snapshotted
+#ifdef _WIN32
+__declspec(dllexport)
+#endif
+WjPluginErrorCode wj_plugin_restore(WjApp* app, const void* buffer, size_t size) {
+    if (!app || !buffer || size < sizeof(PluginState::Snapshot)) {
+        return WJ_INVALID_PARAMETER;
+    }
+    PluginState::Snapshot s;
+    std::memcpy(&s, buffer, sizeof(s));
+    g_plugin_state->restore(s);
+    return WJ_OK;
+}
+
 // Plugin cleanup
 #ifdef _WIN32
 __declspec(dllexport)
@@ -160,6 +423,27 @@ WjPluginErrorCode wj_plugin_cleanup(WjApp* app) {
     }
 }
 
+// Single-symbol entry point: hands the engine every entry point in one
+// table. The per-symbol exports above remain for engines that predate
+// the vtable ABI.
+#ifdef _WIN32
+__declspec(dllexport)
+#endif
+const WjPluginVTable* wj_plugin_entry(void) {
+    static const WjPluginVTable vtable = {
+        WJ_PLUGIN_ABI_VERSION,
+        0,
+        wj_plugin_info,
+        wj_plugin_dependencies,
+        wj_plugin_init,
+        wj_plugin_update,
+        wj_plugin_snapshot,
+        wj_plugin_restore,
+        wj_plugin_cleanup,
+    };
+    return &vtable;
+}
+
 } // extern "C"
 
 // ============================================================================
@@ -0,0 +1,128 @@
+// ffi_overhead — measures the cost of the plugin boundary, mirroring
+// what benches/ does for the Rust side:
+//
+//   1. raw call-crossing latency (out-of-line, per-call)
+//   2. per-element vs batched dispatch over the same work
+//   3. event-queue push/drain throughput
+//   4. frame-arena vs malloc for transient allocations
+//
+// The "boundary" is the mock host in ../testing: out-of-line calls into
+// a separate translation unit, which is the same shape as a call into
+// the host binary minus dlopen relocation. Run with an iteration
+// multiplier for stable numbers (default 1 keeps CI fast):
+//
+//     ./ffi_overhead 100
+
+#include <windjammer/wj_plugin_abi.h>
+
+#include "../testing/mock_host.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename F>
+double ns_per_op(size_t ops, F&& body) {
+    auto start = Clock::now();
+    body();
+    auto end = Clock::now();
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    return ns / (double)ops;
+}
+
+void report(const char* name, double ns, const char* unit) {
+    std::printf("%-32s %10.2f ns/%s\n", name, ns, unit);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t mult = argc > 1 ? (size_t)std::strtoull(argv[1], nullptr, 10) : 1;
+    if (mult == 0) mult = 1;
+
+    WjApp* app = wj_mock_app_create();
+
+    // 1. Raw boundary crossing
+    {
+        const size_t n = 1000000 * mult;
+        double ns = ns_per_op(n, [&] {
+            for (size_t i = 0; i < n; i++) wj_mock_noop(app);
+        });
+        report("boundary_call", ns, "call");
+    }
+
+    // 2. Per-element vs batched dispatch over the same entities
+    {
+        const size_t entities = 100000;
+        const size_t frames = 10 * mult;
+        std::vector<WjEntityId> ids(entities);
+        for (size_t i = 0; i < entities; i++) ids[i] = i + 1;
+
+        double per_element = ns_per_op(entities * frames, [&] {
+            for (size_t f = 0; f < frames; f++)
+                for (size_t i = 0; i < entities; i++)
+                    wj_mock_process_one(app, ids[i]);
+        });
+        report("dispatch_per_element", per_element, "entity");
+
+        double batched = ns_per_op(entities * frames, [&] {
+            for (size_t f = 0; f < frames; f++)
+                wj_mock_process_batch(app, ids.data(), entities);
+        });
+        report("dispatch_batched", batched, "entity");
+        std::printf("%-32s %10.1fx\n", "batch_speedup", per_element / batched);
+    }
+
+    // 3. Event queue throughput (push in batches of 64, drain engine-side)
+    {
+        WjEventQueue* queue = wj_app_event_queue_create(app, 8192);
+        const size_t total = 1000000 * mult;
+        WjEvent batch[64] = {};
+        for (size_t i = 0; i < 64; i++) batch[i].type = 1;
+        std::vector<WjEvent> drained(8192);
+
+        double ns = ns_per_op(total, [&] {
+            size_t pushed = 0;
+            while (pushed < total) {
+                pushed += wj_event_push_batch(queue, batch, 64);
+                wj_mock_events_drain(app, drained.data(), drained.size());
+            }
+        });
+        report("event_queue_push_drain", ns, "event");
+    }
+
+    // 4. Frame arena vs malloc for per-frame transient allocations
+    {
+        const size_t allocs = 10000;
+        const size_t frames = 100 * mult;
+        WjArena* arena = wj_app_frame_arena(app);
+
+        double arena_ns = ns_per_op(allocs * frames, [&] {
+            for (size_t f = 0; f < frames; f++) {
+                for (size_t i = 0; i < allocs; i++) {
+                    void* p = wj_arena_alloc(arena, 64, 16);
+                    if (!p) std::abort();
+                }
+                wj_arena_reset(arena);
+            }
+        });
+        report("arena_alloc", arena_ns, "alloc");
+
+        double malloc_ns = ns_per_op(allocs * frames, [&] {
+            std::vector<void*> ptrs(allocs);
+            for (size_t f = 0; f < frames; f++) {
+                for (size_t i = 0; i < allocs; i++) ptrs[i] = std::malloc(64);
+                for (size_t i = 0; i < allocs; i++) std::free(ptrs[i]);
+            }
+        });
+        report("malloc_free", malloc_ns, "alloc");
+    }
+
+    wj_mock_app_destroy(app);
+    return 0;
+}
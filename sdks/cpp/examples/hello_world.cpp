@@ -0,0 +1,58 @@
+// hello_world — smallest possible Windjammer plugin using the
+// header-only SDK. The WJ_PLUGIN macro emits the single wj_plugin_entry
+// symbol; everything else is an ordinary C++ class.
+
+#include <windjammer/windjammer.hpp>
+
+#include <iostream>
+
+struct HelloPlugin {
+    static constexpr WjPluginInfo kInfo = {
+        "hello_world",
+        "1.0.0",
+        "Smallest possible Windjammer plugin",
+        "Windjammer Team",
+        "MIT",
+        WJ_CATEGORY_OTHER,
+        true,
+    };
+
+    // No shared state: the loader may init this plugin concurrently
+    // with others at the same dependency level
+    static constexpr uint32_t kFlags = WJ_PLUGIN_FLAG_THREADSAFE_INIT;
+
+    void init(wj::App& app) {
+        (void)app;
+        std::cout << "[hello_world] init" << std::endl;
+    }
+
+    void cleanup(wj::App& app) {
+        (void)app;
+        std::cout << "[hello_world] cleanup" << std::endl;
+    }
+};
+
+WJ_PLUGIN(HelloPlugin)
+
+// Standalone driver: does what the engine's loader does — resolve the
+// entry symbol (here a direct call), read the table, run the lifecycle.
+int main() {
+    const WjPluginVTable* vt = wj_plugin_entry();
+
+    WjPluginInfo info = vt->info();
+    std::cout << "plugin:   " << info.name << " " << info.version << std::endl;
+    std::cout << "category: " << static_cast<int>(info.category) << std::endl;
+    std::cout << "abi:      " << vt->abi_version << std::endl;
+
+    WjApp* app = nullptr;  // no engine in this demo
+    if (vt->init(app) != WJ_OK) {
+        std::cerr << "init failed" << std::endl;
+        return 1;
+    }
+    if (vt->cleanup(app) != WJ_OK) {
+        std::cerr << "cleanup failed" << std::endl;
+        return 1;
+    }
+    std::cout << "ok" << std::endl;
+    return 0;
+}
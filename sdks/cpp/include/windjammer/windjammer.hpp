@@ -0,0 +1,1026 @@
+// Windjammer C++ SDK — header-only, zero-overhead wrappers over the
+// C plugin ABI (wj_plugin_abi.h).
+//
+// Every wrapper here is a thin inline shim: strongly typed handles,
+// RAII where ownership exists, and compile-time checks where the C ABI
+// could only fail at load time. Nothing adds indirection — with any
+// optimizing compiler these wrappers compile down to the raw C calls.
+//
+// A minimal plugin:
+//
+//     #include <windjammer/windjammer.hpp>
+//
+//     struct MyPlugin {
+//         static constexpr WjPluginInfo kInfo = {
+//             "my_plugin", "1.0.0", "What it does",
+//             "You", "MIT", WJ_CATEGORY_OTHER, true,
+//         };
+//         void init(wj::App& app) {}
+//         void update(wj::App& app, const WjFrameBatch& batch) {}
+//         void cleanup(wj::App& app) {}
+//     };
+//
+//     WJ_PLUGIN(MyPlugin)
+
+#ifndef WINDJAMMER_WINDJAMMER_HPP
+#define WINDJAMMER_WINDJAMMER_HPP
+
+#include <windjammer/wj_plugin_abi.h>
+
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace wj {
+
+// ============================================================================
+// Compile-time checks
+// ============================================================================
+
+// Validates "major.minor.patch" at compile time, so a malformed version
+// string is a build error instead of a WJ_VERSION_MISMATCH at load time.
+constexpr bool version_valid(const char* v) {
+    int dots = 0;
+    int digits_in_part = 0;
+    for (; *v; ++v) {
+        if (*v == '.') {
+            if (digits_in_part == 0) return false;
+            ++dots;
+            digits_in_part = 0;
+        } else if (*v >= '0' && *v <= '9') {
+            ++digits_in_part;
+        } else {
+            return false;
+        }
+    }
+    return dots == 2 && digits_in_part > 0;
+}
+
+constexpr bool category_valid(WjPluginCategory c) {
+    return c >= WJ_CATEGORY_RENDERING && c <= WJ_CATEGORY_OTHER;
+}
+
+// ============================================================================
+// Arena
+// ============================================================================
+
+// Non-owning handle to an engine arena. Allocation is a pointer bump;
+// lifetime of every allocation ends when the engine resets the arena at
+// the frame boundary, so only trivially-destructible types belong here.
+class Arena {
+public:
+    explicit Arena(WjArena* raw) noexcept : raw_(raw) {}
+
+    WjArena* raw() const noexcept { return raw_; }
+
+    void* alloc_bytes(size_t size, size_t align) const noexcept {
+        return wj_arena_alloc(raw_, size, align);
+    }
+
+    // Typed array allocation; returns nullptr if the arena is exhausted
+    template <typename T>
+    T* alloc(size_t count = 1) const noexcept {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "arena memory is freed wholesale — destructors never run");
+        return static_cast<T*>(alloc_bytes(count * sizeof(T), alignof(T)));
+    }
+
+private:
+    WjArena* raw_;
+};
+
+// ============================================================================
+// Component views
+// ============================================================================
+
+// Typed, stride-aware view over an engine-owned component array.
+// Iteration walks engine memory in place — no copies.
+template <typename T>
+class ComponentSpan {
+public:
+    class iterator {
+    public:
+        iterator(char* p, size_t stride) noexcept : p_(p), stride_(stride) {}
+        T& operator*() const noexcept { return *reinterpret_cast<T*>(p_); }
+        T* operator->() const noexcept { return reinterpret_cast<T*>(p_); }
+        iterator& operator++() noexcept { p_ += stride_; return *this; }
+        bool operator!=(const iterator& o) const noexcept { return p_ != o.p_; }
+
+    private:
+        char* p_;
+        size_t stride_;
+    };
+
+    explicit ComponentSpan(const WjComponentView& view) noexcept : view_(view) {}
+
+    size_t size() const noexcept { return view_.count; }
+    bool empty() const noexcept { return view_.count == 0; }
+    uint32_t generation() const noexcept { return view_.generation; }
+
+    T& operator[](size_t i) const noexcept {
+        return *reinterpret_cast<T*>(static_cast<char*>(view_.data) + i * view_.stride);
+    }
+
+    iterator begin() const noexcept {
+        return iterator(static_cast<char*>(view_.data), view_.stride);
+    }
+    iterator end() const noexcept {
+        return iterator(static_cast<char*>(view_.data) + view_.count * view_.stride,
+                        view_.stride);
+    }
+
+private:
+    WjComponentView view_;
+};
+
+// ============================================================================
+// Chunked queries
+// ============================================================================
+
+// Typed query over entities holding every component in Ts..., iterated
+// as dense SoA chunks. Create once at init, range-for every frame:
+//
+//   for (auto chunk : query) {
+//       Transform* t = chunk.column<0>();
+//       Velocity* v = chunk.column<1>();
+//       for (uint32_t i = 0; i < chunk.size(); i++) ...
+//   }
+//
+// Each column is a contiguous array the compiler can vectorize over;
+// no per-entity indirection.
+template <typename... Ts>
+class Query {
+    static_assert(sizeof...(Ts) >= 1 && sizeof...(Ts) <= WJ_QUERY_MAX_COMPONENTS,
+                  "query signature must name 1..WJ_QUERY_MAX_COMPONENTS components");
+
+public:
+    class Chunk {
+    public:
+        explicit Chunk(const WjQueryChunk& raw) noexcept : raw_(raw) {}
+
+        uint32_t size() const noexcept { return raw_.count; }
+        const WjEntityId* entities() const noexcept { return raw_.entities; }
+
+        // Dense array for the I-th component of the signature
+        template <size_t I>
+        auto column() const noexcept {
+            static_assert(I < sizeof...(Ts), "column index outside signature");
+            using T = std::tuple_element_t<I, std::tuple<Ts...>>;
+            return static_cast<T*>(raw_.columns[I]);
+        }
+
+    private:
+        WjQueryChunk raw_;
+    };
+
+    class iterator {
+    public:
+        iterator(WjQuery* q, bool live) noexcept : q_(q), live_(live) {
+            if (live_) advance();
+        }
+        Chunk operator*() const noexcept { return Chunk(chunk_); }
+        iterator& operator++() noexcept { advance(); return *this; }
+        bool operator!=(const iterator& o) const noexcept { return live_ != o.live_; }
+
+    private:
+        void advance() noexcept { live_ = q_ && wj_query_next(q_, &chunk_); }
+
+        WjQuery* q_;
+        bool live_;
+        WjQueryChunk chunk_ = {};
+    };
+
+    Query(WjApp* app, WjQuery* raw) noexcept : app_(app), raw_(raw) {}
+    ~Query() {
+        if (raw_) wj_query_destroy(app_, raw_);
+    }
+    Query(Query&& o) noexcept : app_(o.app_), raw_(o.raw_) { o.raw_ = nullptr; }
+    Query& operator=(Query&& o) noexcept {
+        if (this != &o) {
+            if (raw_) wj_query_destroy(app_, raw_);
+            app_ = o.app_;
+            raw_ = o.raw_;
+            o.raw_ = nullptr;
+        }
+        return *this;
+    }
+    Query(const Query&) = delete;
+    Query& operator=(const Query&) = delete;
+
+    bool valid() const noexcept { return raw_ != nullptr; }
+
+    iterator begin() const noexcept { return iterator(raw_, true); }
+    iterator end() const noexcept { return iterator(raw_, false); }
+
+private:
+    WjApp* app_;
+    WjQuery* raw_;
+};
+
+// ============================================================================
+// Command buffer
+// ============================================================================
+
+// Non-owning wrapper over the frame's command buffer (batch.commands).
+// Recording is wait-free — commands land in per-thread frame-arena
+// chunks — and the engine applies everything at one sync point after
+// all plugins have run.
+class CommandBuffer {
+public:
+    explicit CommandBuffer(WjCommandBuffer* raw) noexcept : raw_(raw) {}
+
+    // Spawn an entity; the provisional id is usable in commands
+    // recorded later this frame
+    WjEntityId spawn() const noexcept { return wj_cmd_spawn(raw_); }
+
+    void despawn(WjEntityId entity) const noexcept {
+        wj_cmd_despawn(raw_, entity);
+    }
+
+    // Attach a component value (copied; the argument may be a stack
+    // temporary). T's layout must match the engine's registered layout.
+    template <typename T>
+    bool add_component(WjEntityId entity, WjComponentTypeId type,
+                       const T& value) const noexcept {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "component payloads are copied as raw bytes");
+        return wj_cmd_add_component(raw_, entity, type, &value, sizeof(T));
+    }
+
+private:
+    WjCommandBuffer* raw_;
+};
+
+// ============================================================================
+// Frame pinning
+// ============================================================================
+
+// RAII pin on the newest published frame snapshot: immutable while
+// held, safe to read from any thread, released on destruction. Hold it
+// for the duration of one analysis pass, not across frames — pinning
+// both buffers stalls publication.
+class FrameView {
+public:
+    FrameView(WjApp* app, WjFrameView* view) noexcept : app_(app), view_(view) {}
+    ~FrameView() {
+        if (view_) wj_frame_release(app_, view_);
+    }
+    FrameView(FrameView&& o) noexcept : app_(o.app_), view_(o.view_) {
+        o.view_ = nullptr;
+    }
+    FrameView& operator=(FrameView&& o) noexcept {
+        if (this != &o) {
+            if (view_) wj_frame_release(app_, view_);
+            app_ = o.app_;
+            view_ = o.view_;
+            o.view_ = nullptr;
+        }
+        return *this;
+    }
+    FrameView(const FrameView&) = delete;
+    FrameView& operator=(const FrameView&) = delete;
+
+    // False before the first frame has been published
+    bool valid() const noexcept { return view_ != nullptr; }
+
+    uint64_t frame() const noexcept {
+        return view_ ? wj_frame_number(view_) : 0;
+    }
+
+    // Read-only typed view into the snapshot
+    template <typename T>
+    ComponentSpan<const T> view(WjComponentTypeId type) const noexcept {
+        WjComponentView v = {};
+        if (view_) wj_frame_component_view(view_, type, &v);
+        return ComponentSpan<const T>(v);
+    }
+
+private:
+    WjApp* app_;
+    WjFrameView* view_;
+};
+
+// ============================================================================
+// Event queue
+// ============================================================================
+
+// Non-owning handle to this plugin's outbound SPSC event queue (the
+// engine owns the storage and destroys it at unload)
+class EventQueue {
+public:
+    EventQueue() noexcept : raw_(nullptr) {}
+    explicit EventQueue(WjEventQueue* raw) noexcept : raw_(raw) {}
+
+    WjEventQueue* raw() const noexcept { return raw_; }
+    explicit operator bool() const noexcept { return raw_ != nullptr; }
+
+    bool push(const WjEvent& event) const noexcept {
+        return wj_event_push(raw_, &event);
+    }
+
+    size_t push(const WjEvent* events, size_t count) const noexcept {
+        return wj_event_push_batch(raw_, events, count);
+    }
+
+private:
+    WjEventQueue* raw_;
+};
+
+// ============================================================================
+// Profiling
+// ============================================================================
+
+// RAII profiling zone: begins on construction, ends when the scope
+// exits. Intern the zone name once (at init) and reuse the id.
+class ProfileZone {
+public:
+    ProfileZone(WjApp* app, WjStrId zone) noexcept : app_(app) {
+        wj_profile_zone_begin(app_, zone);
+    }
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+    ~ProfileZone() { wj_profile_zone_end(app_); }
+
+private:
+    WjApp* app_;
+};
+
+// ============================================================================
+// Assets
+// ============================================================================
+
+// RAII over a memory-mapped asset view: unmapped when the last owner
+// goes out of scope. Move-only, like the mapping it represents.
+class Asset {
+public:
+    Asset() noexcept : app_(nullptr), view_{nullptr, 0} {}
+    Asset(WjApp* app, WjAssetView view) noexcept : app_(app), view_(view) {}
+
+    Asset(const Asset&) = delete;
+    Asset& operator=(const Asset&) = delete;
+
+    Asset(Asset&& o) noexcept : app_(o.app_), view_(o.view_) {
+        o.view_ = {nullptr, 0};
+    }
+    Asset& operator=(Asset&& o) noexcept {
+        if (this != &o) {
+            release();
+            app_ = o.app_;
+            view_ = o.view_;
+            o.view_ = {nullptr, 0};
+        }
+        return *this;
+    }
+
+    ~Asset() { release(); }
+
+    explicit operator bool() const noexcept { return view_.data != nullptr; }
+    const void* data() const noexcept { return view_.data; }
+    size_t size() const noexcept { return view_.size; }
+
+    template <typename T>
+    const T* as() const noexcept {
+        return static_cast<const T*>(view_.data);
+    }
+
+private:
+    void release() noexcept {
+        if (view_.data) {
+            wj_asset_unmap(app_, &view_);
+            view_ = {nullptr, 0};
+        }
+    }
+
+    WjApp* app_;
+    WjAssetView view_;
+};
+
+// ============================================================================
+// Handles
+// ============================================================================
+
+// Typed generational handle. Resolution fails fast for stale handles;
+// re-resolve every time you cross back into plugin code rather than
+// caching the pointer, so the engine stays free to relocate objects.
+template <typename T>
+class Handle {
+public:
+    Handle() noexcept : raw_(WJ_HANDLE_INVALID) {}
+    explicit Handle(WjHandle raw) noexcept : raw_(raw) {}
+
+    WjHandle raw() const noexcept { return raw_; }
+    uint32_t index() const noexcept { return WJ_HANDLE_INDEX(raw_); }
+    uint32_t generation() const noexcept { return WJ_HANDLE_GENERATION(raw_); }
+    explicit operator bool() const noexcept { return raw_ != WJ_HANDLE_INVALID; }
+
+    bool operator==(const Handle& o) const noexcept { return raw_ == o.raw_; }
+    bool operator!=(const Handle& o) const noexcept { return raw_ != o.raw_; }
+
+    // Current address of the object, or nullptr if the handle is stale
+    T* resolve(WjApp* app) const noexcept {
+        return static_cast<T*>(wj_handle_resolve(app, raw_));
+    }
+
+    bool valid(WjApp* app) const noexcept { return wj_handle_valid(app, raw_); }
+
+private:
+    WjHandle raw_;
+};
+
+// ============================================================================
+// Message bus
+// ============================================================================
+
+// Non-owning handle to a topic subscription (engine-owned storage,
+// destroyed at plugin unload)
+class Subscription {
+public:
+    Subscription() noexcept : raw_(nullptr) {}
+    explicit Subscription(WjSubscription* raw) noexcept : raw_(raw) {}
+
+    WjSubscription* raw() const noexcept { return raw_; }
+    explicit operator bool() const noexcept { return raw_ != nullptr; }
+
+    // Drain up to capacity pending messages
+    size_t consume(WjMessage* out, size_t capacity) const noexcept {
+        return wj_bus_consume(raw_, out, capacity);
+    }
+
+private:
+    WjSubscription* raw_;
+};
+
+// ============================================================================
+// Sprites
+// ============================================================================
+
+// Writable slice of the engine's persistently-mapped sprite instance
+// buffer. Write instances via operator[] or push(), then commit();
+// an unconsumed batch publishes nothing.
+class SpriteBatch {
+public:
+    SpriteBatch(WjApp* app, WjSpriteBatch batch) noexcept
+        : app_(app), batch_(batch), written_(0) {}
+
+    explicit operator bool() const noexcept { return batch_.instances != nullptr; }
+    size_t capacity() const noexcept { return batch_.capacity; }
+    size_t size() const noexcept { return written_; }
+
+    WjSpriteInstance& operator[](size_t i) noexcept { return batch_.instances[i]; }
+
+    // Append one instance; false once the slice is full
+    bool push(const WjSpriteInstance& s) noexcept {
+        if (written_ >= batch_.capacity) return false;
+        batch_.instances[written_++] = s;
+        return true;
+    }
+
+    // Publish everything pushed (or the first count slots if the
+    // caller wrote through operator[])
+    WjPluginErrorCode commit() noexcept { return commit(written_); }
+    WjPluginErrorCode commit(size_t count) noexcept {
+        return wj_sprites_commit(app_, &batch_, count);
+    }
+
+private:
+    WjApp* app_;
+    WjSpriteBatch batch_;
+    size_t written_;
+};
+
+// ============================================================================
+// Jobs
+// ============================================================================
+
+namespace detail {
+
+// Thunk turning a C++ callable into a WjParallelForFn. The callable
+// lives on the caller's stack for the duration of the (synchronous)
+// parallel_for, so no allocation and no lifetime question.
+template <typename Fn>
+void parallel_for_thunk(void* data, size_t begin, size_t end, uint32_t worker) {
+    (*static_cast<Fn*>(data))(begin, end, worker);
+}
+
+// Pack a log argument into the raw word wj_log carries. Integers and
+// pointers widen; doubles travel as their bit pattern (the formatter's
+// {f} placeholder reverses this).
+template <typename T>
+uint64_t log_word(T v) {
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                  "log arguments must be integers, doubles, or pointers");
+    return (uint64_t)v;
+}
+inline uint64_t log_word(double v) {
+    uint64_t w;
+    std::memcpy(&w, &v, sizeof(w));
+    return w;
+}
+template <typename T>
+uint64_t log_word(T* v) {
+    return (uint64_t)(uintptr_t)v;
+}
+
+}  // namespace detail
+
+// Handle to a submitted job; join it with wait() before the data it
+// captures goes out of scope
+class Job {
+public:
+    Job() noexcept : app_(nullptr), job_(0) {}
+    Job(WjApp* app, WjJob job) noexcept : app_(app), job_(job) {}
+
+    // False when the scheduler was saturated and nothing was queued
+    explicit operator bool() const noexcept { return job_ != 0; }
+
+    void wait() const noexcept {
+        if (job_ != 0) wj_job_wait(app_, job_);
+    }
+
+private:
+    WjApp* app_;
+    WjJob job_;
+};
+
+// ============================================================================
+// App
+// ============================================================================
+
+// Strongly typed handle to the engine. Non-owning: the WjApp outlives
+// every plugin entry point it is passed to.
+class App {
+public:
+    explicit App(WjApp* raw) noexcept : raw_(raw) {}
+
+    WjApp* raw() const noexcept { return raw_; }
+
+    // This plugin's per-frame arena (reset by the engine after update)
+    Arena frame_arena() const noexcept {
+        return Arena(wj_app_frame_arena(raw_));
+    }
+
+    // Zero-copy typed view over an engine component array. T's layout
+    // must match the engine's registered layout for the type id.
+    template <typename T>
+    ComponentSpan<T> view(WjComponentTypeId type, bool writable = true) const noexcept {
+        WjComponentView v = {};
+        wj_app_component_view(raw_, type, writable, &v);
+        return ComponentSpan<T>(v);
+    }
+
+    // Compile a component signature into a chunked SoA query (create
+    // once at init, iterate every frame). The type list and id list are
+    // parallel: query<Transform, Velocity>({WJ_COMPONENT_TRANSFORM,
+    // WJ_COMPONENT_VELOCITY}). Invalid signatures yield !valid().
+    template <typename... Ts>
+    Query<Ts...> query(const WjComponentTypeId (&types)[sizeof...(Ts)],
+                       bool writable = true) const noexcept {
+        return Query<Ts...>(raw_,
+                            wj_query_create(raw_, types, sizeof...(Ts), writable));
+    }
+
+    // Pin the newest published frame snapshot for overlapped,
+    // lock-free reading while the engine builds the next frame
+    FrameView acquire_frame() const noexcept {
+        return FrameView(raw_, wj_frame_acquire(raw_));
+    }
+
+    // Create this plugin's outbound event queue (call once, from init)
+    EventQueue create_event_queue(size_t capacity) const noexcept {
+        return EventQueue(wj_app_event_queue_create(raw_, capacity));
+    }
+
+    // Bulk-poll pending engine events (input, collisions, lifecycle)
+    // into a plugin-owned buffer: one boundary crossing per frame.
+    // Align the buffer to 16 for vectorized type-id scans.
+    size_t poll_events(WjEngineEvent* buffer, size_t capacity) const noexcept {
+        return wj_events_poll(raw_, buffer, capacity);
+    }
+
+    // Record a structured error for this thread: a few plain stores,
+    // safe on any hot path. Pair with a non-WJ_OK return.
+    void set_error(uint32_t code, WjStrId source, int64_t arg0 = 0,
+                   int64_t arg1 = 0) const noexcept {
+        wj_error_set(raw_, code, source, arg0, arg1);
+    }
+
+    // Copy out and clear this thread's error record; false when clean
+    bool last_error(WjErrorRecord* out) const noexcept {
+        return wj_error_get(raw_, out);
+    }
+
+    // Deferred log: an interned format id plus raw argument words into
+    // a per-thread lock-free buffer; a background engine thread formats
+    // and writes. Integers, doubles and interned ids pass through as
+    // words (see also WJ_LOG, which caches the interned format per call
+    // site). Never use iostream on a frame path.
+    template <typename... Args>
+    void log(WjLogLevel level, WjStrId format, Args... args) const noexcept {
+        static_assert(sizeof...(Args) <= WJ_LOG_MAX_ARGS,
+                      "wj_log carries at most WJ_LOG_MAX_ARGS argument words");
+        uint64_t words[sizeof...(Args) > 0 ? sizeof...(Args) : 1] = {
+            detail::log_word(args)...};
+        wj_log(raw_, level, format, words, (uint32_t)sizeof...(Args));
+    }
+
+    // Open a profiling zone for the current scope (see also
+    // WJ_PROFILE_SCOPE, which caches the interned name per call site)
+    ProfileZone profile(WjStrId zone) const noexcept {
+        return ProfileZone(raw_, zone);
+    }
+
+    // The engine's frame clock: fetch the pointer once at init, then
+    // every read is a plain load (no syscall, no boundary crossing)
+    const WjFrameClock* frame_clock() const noexcept {
+        return wj_app_frame_clock(raw_);
+    }
+
+    // Convert a wj_ticks() interval to nanoseconds with the engine's
+    // calibrated counter frequency
+    uint64_t ticks_to_ns(uint64_t ticks) const noexcept {
+        return wj_ticks_to_ns(raw_, ticks);
+    }
+
+    // Intern a string once (cold path); compare the returned ids on the
+    // hot path instead of strcmp
+    WjStrId intern(const char* str) const noexcept {
+        return wj_intern(raw_, str);
+    }
+
+    // Reverse lookup of an interned id, for diagnostics
+    const char* str(WjStrId id) const noexcept {
+        return wj_str_lookup(raw_, id);
+    }
+
+    // Map an asset pack region read-only, zero-copy (empty Asset on
+    // failure). Prefer prefetch_asset ahead of time for cold loads.
+    Asset map_asset(const char* path) const noexcept {
+        WjAssetView v = {nullptr, 0};
+        wj_asset_map(raw_, path, &v);
+        return Asset(raw_, v);
+    }
+
+    // Advisory: start faulting an asset's pages in from disk
+    void prefetch_asset(const char* path) const noexcept {
+        wj_asset_prefetch(raw_, path);
+    }
+
+    // Resolve a typed generational handle (nullptr when stale)
+    template <typename T>
+    T* resolve(Handle<T> handle) const noexcept {
+        return handle.resolve(raw_);
+    }
+
+    // Subscribe to a bus topic (allocate once at init; consuming and
+    // publishing never allocate)
+    Subscription subscribe(WjStrId topic, size_t capacity) const noexcept {
+        return Subscription(wj_bus_subscribe(raw_, topic, capacity));
+    }
+
+    // Publish a message batch to every subscriber of each topic
+    size_t publish(const WjMessage* messages, size_t count) const noexcept {
+        return wj_bus_publish(raw_, messages, count);
+    }
+
+    // Reserve a writable slice of this frame's sprite instance buffer
+    SpriteBatch acquire_sprites(size_t capacity) const noexcept {
+        WjSpriteBatch b = {nullptr, 0};
+        wj_sprites_acquire(raw_, capacity, &b);
+        return SpriteBatch(raw_, b);
+    }
+
+    // Reserve a writable slice of the persistently-mapped GPU staging
+    // ring (write sequentially; the memory is typically write-combined).
+    // false when the ring is full until in-flight fences retire.
+    bool acquire_staging(size_t size, size_t align,
+                         WjStagingSlice* out) const noexcept {
+        return wj_staging_acquire(raw_, size, align, out);
+    }
+
+    // Queue a staged slice for upload into an engine resource. The
+    // returned future completes when the GPU copy retires and the
+    // slice's ring space is reusable.
+    WjFuture submit_staging(const WjStagingSlice& slice,
+                            WjHandle destination) const noexcept {
+        return wj_staging_submit(raw_, &slice, destination);
+    }
+
+    // Snapshot a plugin's resource counters (WJ_STR_INVALID names the
+    // calling plugin); cheap enough to poll from a dashboard plugin
+    bool plugin_stats(WjPluginStats* out,
+                      WjStrId plugin = WJ_STR_INVALID) const noexcept {
+        return wj_plugin_stats(raw_, plugin, out);
+    }
+
+    // Engine worker threads available to plugin jobs
+    uint32_t worker_count() const noexcept {
+        return wj_app_worker_count(raw_);
+    }
+
+    // Submit one job to the engine's work-stealing scheduler; data must
+    // stay valid until the returned Job is waited on
+    Job submit(WjJobFn fn, void* data) const noexcept {
+        return Job(raw_, wj_job_submit(raw_, fn, data));
+    }
+
+    // Fan fn(begin, end, worker) over [0, count) across all engine
+    // workers and wait. The callable stays on this thread's stack —
+    // captures are free and nothing allocates.
+    template <typename Fn>
+    void parallel_for(size_t count, Fn&& fn, size_t grain = 0) const {
+        wj_job_parallel_for(raw_, count, grain,
+                            &detail::parallel_for_thunk<std::remove_reference_t<Fn>>,
+                            &fn);
+    }
+
+private:
+    WjApp* raw_;
+};
+
+// ============================================================================
+// Plugin registration
+// ============================================================================
+
+namespace detail {
+
+template <typename T, typename = void>
+struct has_update : std::false_type {};
+template <typename T>
+struct has_update<T, std::void_t<decltype(std::declval<T&>().update(
+                         std::declval<App&>(), std::declval<const WjFrameBatch&>()))>>
+    : std::true_type {};
+
+template <typename T, typename = void>
+struct has_dependencies : std::false_type {};
+template <typename T>
+struct has_dependencies<T, std::void_t<decltype(T::kDependencies)>> : std::true_type {};
+
+template <typename T, typename = void>
+struct has_flags : std::false_type {};
+template <typename T>
+struct has_flags<T, std::void_t<decltype(T::kFlags)>> : std::true_type {};
+
+template <typename T>
+constexpr uint32_t plugin_flags() {
+    if constexpr (has_flags<T>::value) {
+        return T::kFlags;
+    } else {
+        return 0;
+    }
+}
+
+template <typename T, typename = void>
+struct has_persistent_state : std::false_type {};
+template <typename T>
+struct has_persistent_state<T, std::void_t<decltype(T::kPersistentState)>>
+    : std::integral_constant<bool, T::kPersistentState> {};
+
+template <typename T, typename = void>
+struct has_snapshot : std::false_type {};
+template <typename T>
+struct has_snapshot<T, std::void_t<typename T::Snapshot,
+                                   decltype(std::declval<const T&>().snapshot()),
+                                   decltype(std::declval<T&>().restore(
+                                       std::declval<const typename T::Snapshot&>()))>>
+    : std::true_type {};
+
+// Static thunks binding the C vtable slots to one instance of the
+// plugin class. Each thunk is a tail call into the user's method.
+template <typename T>
+struct Registration {
+    static_assert(version_valid(T::kInfo.version),
+                  "kInfo.version must be of the form major.minor.patch");
+    static_assert(category_valid(T::kInfo.category),
+                  "kInfo.category must be a WjPluginCategory value");
+
+    static T*& instance() noexcept {
+        static T* inst = nullptr;
+        return inst;
+    }
+
+    static WjPluginInfo info() { return T::kInfo; }
+
+    static const WjPluginDependency* dependencies(size_t* out_count) {
+        if constexpr (has_dependencies<T>::value) {
+            *out_count = sizeof(T::kDependencies) / sizeof(T::kDependencies[0]);
+            return T::kDependencies;
+        } else {
+            *out_count = 0;
+            return nullptr;
+        }
+    }
+
+    static WjPluginErrorCode init(WjApp* raw) {
+        try {
+            if constexpr (has_persistent_state<T>::value) {
+                // State lives in the engine's pool: same address across
+                // hot reloads, so the reloaded library re-adopts the
+                // bytes instead of reconstructing
+                static_assert(std::is_trivially_copyable<T>::value &&
+                                  std::is_trivially_destructible<T>::value,
+                              "kPersistentState requires trivially copyable, "
+                              "trivially destructible state (no pointers into "
+                              "plugin memory)");
+                bool created = false;
+                void* mem = wj_state_acquire(raw, wj_intern(raw, T::kInfo.name),
+                                             sizeof(T), alignof(T), &created);
+                if (!mem) return WJ_LOAD_FAILED;
+                instance() = created ? new (mem) T() : static_cast<T*>(mem);
+            } else {
+                instance() = new T();
+            }
+            App app(raw);
+            instance()->init(app);
+            return WJ_OK;
+        } catch (...) {
+            return WJ_LOAD_FAILED;
+        }
+    }
+
+    static WjPluginErrorCode update(WjApp* raw, const WjFrameBatch* batch) {
+        if constexpr (has_update<T>::value) {
+            // Hot path: no try/catch, no allocation — a plugin that can
+            // fail per frame should report through the event queue
+            App app(raw);
+            instance()->update(app, *batch);
+            return WJ_OK;
+        } else {
+            (void)raw;
+            (void)batch;
+            return WJ_OK;
+        }
+    }
+
+    static WjPluginErrorCode snapshot(WjApp* raw, void* buffer, size_t* size) {
+        (void)raw;
+        if constexpr (has_snapshot<T>::value) {
+            using S = typename T::Snapshot;
+            static_assert(std::is_trivially_copyable<S>::value,
+                          "hot-reload snapshots must be memcpy-able");
+            if (!buffer) {
+                *size = sizeof(S);
+                return WJ_OK;
+            }
+            if (*size < sizeof(S)) return WJ_INVALID_PARAMETER;
+            S s = instance()->snapshot();
+            std::memcpy(buffer, &s, sizeof(S));
+            *size = sizeof(S);
+            return WJ_OK;
+        } else {
+            (void)buffer;
+            (void)size;
+            return WJ_INVALID_PARAMETER;
+        }
+    }
+
+    static WjPluginErrorCode restore(WjApp* raw, const void* buffer, size_t size) {
+        (void)raw;
+        if constexpr (has_snapshot<T>::value) {
+            using S = typename T::Snapshot;
+            if (!buffer || size < sizeof(S)) return WJ_INVALID_PARAMETER;
+            S s;
+            std::memcpy(&s, buffer, sizeof(S));
+            instance()->restore(s);
+            return WJ_OK;
+        } else {
+            (void)buffer;
+            (void)size;
+            return WJ_INVALID_PARAMETER;
+        }
+    }
+
+    static WjPluginErrorCode cleanup(WjApp* raw) {
+        try {
+            App app(raw);
+            instance()->cleanup(app);
+            if constexpr (!has_persistent_state<T>::value) {
+                delete instance();
+            }
+            // Pooled state is left in place for the next load; the
+            // engine releases the slot on final unload
+            instance() = nullptr;
+            return WJ_OK;
+        } catch (...) {
+            return WJ_UNLOAD_FAILED;
+        }
+    }
+
+    static const WjPluginVTable* vtable() noexcept {
+        static const WjPluginVTable table = {
+            WJ_PLUGIN_ABI_VERSION,
+            plugin_flags<T>(),
+            &Registration::info,
+            &Registration::dependencies,
+            &Registration::init,
+            has_update<T>::value ? &Registration::update : nullptr,
+            has_snapshot<T>::value ? &Registration::snapshot : nullptr,
+            has_snapshot<T>::value ? &Registration::restore : nullptr,
+            &Registration::cleanup,
+        };
+        return &table;
+    }
+};
+
+}  // namespace detail
+
+// ============================================================================
+// Static plugin linking
+// ============================================================================
+
+// One statically-linked plugin in the host binary's registry. The
+// vtables carry the same WjPluginInfo metadata as dynamic plugins; the
+// host walks static_plugins() instead of dlopen-ing a directory.
+struct StaticPluginEntry {
+    const WjPluginVTable* vtable;
+    const StaticPluginEntry* next;
+};
+
+namespace detail {
+
+inline const StaticPluginEntry*& static_plugin_head() noexcept {
+    static const StaticPluginEntry* head = nullptr;
+    return head;
+}
+
+// Links one entry into the registry at static-init time (no dlopen,
+// no allocation; entries live in the registrar objects themselves)
+struct StaticPluginRegistrar {
+    StaticPluginEntry entry;
+    explicit StaticPluginRegistrar(const WjPluginVTable* vt) noexcept {
+        entry.vtable = vt;
+        entry.next = static_plugin_head();
+        static_plugin_head() = &entry;
+    }
+};
+
+}  // namespace detail
+
+// Head of the static plugin registry (reverse registration order);
+// nullptr when no plugin is linked statically
+inline const StaticPluginEntry* static_plugins() noexcept {
+    return detail::static_plugin_head();
+}
+
+}  // namespace wj
+
+// Emits the single exported wj_plugin_entry symbol for a plugin class.
+// The class provides `static constexpr WjPluginInfo kInfo`, an init and
+// cleanup method, and optionally update, kDependencies, kFlags
+// (WJ_PLUGIN_FLAG_* capability bits), and a Snapshot type with
+// snapshot()/restore() for hot reload. A plugin whose state is
+// trivially copyable can instead set
+// `static constexpr bool kPersistentState = true` to place it in the
+// engine's state pool: the same address (and the same bytes) come back
+// after a hot reload, so init() runs against surviving state.
+// With WJ_STATIC_PLUGINS defined, WJ_PLUGIN registers into the host
+// binary's static registry instead: same metadata and entry points, no
+// dlopen or PLT indirection, every body visible to LTO for inlining
+// into the frame loop. Plugin sources build either way unchanged —
+// dynamic for development iteration, static for production servers
+// whose plugin set is fixed at build time. (Static mode is also the
+// only way to link several plugins into one binary, since each dynamic
+// plugin must own the sole wj_plugin_entry export.)
+#if defined(WJ_STATIC_PLUGINS)
+#define WJ_PLUGIN(PluginType) WJ_STATIC_PLUGIN(PluginType)
+#else
+#define WJ_PLUGIN(PluginType)                                      \
+    extern "C" WJ_PLUGIN_EXPORT const WjPluginVTable*              \
+    wj_plugin_entry(void) {                                        \
+        return ::wj::detail::Registration<PluginType>::vtable();   \
+    }
+#endif
+
+// Compile a plugin into the host binary, registering its vtable at
+// static-init time. Usable directly, or implicitly through WJ_PLUGIN
+// under -DWJ_STATIC_PLUGINS.
+#define WJ_STATIC_PLUGIN(PluginType)                                         \
+    static const ::wj::detail::StaticPluginRegistrar                         \
+        WJ_DETAIL_CONCAT(wj_static_plugin_, __COUNTER__)(                    \
+            ::wj::detail::Registration<PluginType>::vtable());
+
+// Scoped profiling zone with the interned name cached per call site:
+// the string is interned on first execution (thread-safe static), after
+// which each pass costs only the zone begin/end stores.
+#define WJ_DETAIL_CONCAT2(a, b) a##b
+#define WJ_DETAIL_CONCAT(a, b) WJ_DETAIL_CONCAT2(a, b)
+#define WJ_PROFILE_SCOPE(app, name)                                          \
+    static const WjStrId WJ_DETAIL_CONCAT(wj_zone_id_, __LINE__) =           \
+        (app).intern(name);                                                  \
+    ::wj::ProfileZone WJ_DETAIL_CONCAT(wj_zone_, __LINE__)(                  \
+        (app).raw(), WJ_DETAIL_CONCAT(wj_zone_id_, __LINE__))
+
+// Deferred log with the interned format cached per call site, same
+// pattern as WJ_PROFILE_SCOPE: interning happens once, every later
+// pass is a few stores into the per-thread log buffer.
+//   WJ_LOG(app, WJ_LOG_INFO, "spawned {} entities in {f} ms", n, ms);
+#define WJ_LOG(app, level, format, ...)                                      \
+    do {                                                                     \
+        static const WjStrId WJ_DETAIL_CONCAT(wj_log_id_, __LINE__) =        \
+            (app).intern(format);                                            \
+        (app).log((level), WJ_DETAIL_CONCAT(wj_log_id_, __LINE__),           \
+                  ##__VA_ARGS__);                                            \
+    } while (0)
+
+#endif  // WINDJAMMER_WINDJAMMER_HPP
@@ -0,0 +1,177 @@
+// Windjammer C++ SDK — binary plugin manifest (.wjm sidecar).
+//
+// A fixed-layout, little-endian file emitted at plugin build time from
+// the same WjPluginInfo / WjPluginDependency data the plugin exports.
+// It lets the engine list and dependency-resolve a directory of plugins
+// with one small pread per file instead of dlopen-ing every shared
+// object (which runs static initializers and pages in the whole
+// library) just to read a WjPluginInfo.
+//
+// The file is one contiguous block: header, dependency table, string
+// table. total_size is bounded by WJ_MANIFEST_MAX_SIZE so a reader can
+// fetch the entire manifest in a single read. Strings are referenced by
+// byte offset into the string table and are NUL-terminated.
+//
+// tools/wj-manifest-gen emits the sidecar from a built plugin; the
+// engine's loader consumes it. read_manifest() below is the reference
+// reader.
+
+#ifndef WINDJAMMER_WJ_MANIFEST_HPP
+#define WINDJAMMER_WJ_MANIFEST_HPP
+
+#include <windjammer/wj_plugin_abi.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace wj {
+
+// "WJPM", little-endian
+constexpr uint32_t kManifestMagic = 0x4D504A57u;
+constexpr uint32_t kManifestVersion = 1;
+
+// Manifests are deliberately small; one pread of this many bytes always
+// captures the whole file
+constexpr uint32_t kManifestMaxSize = 4096;
+
+// File header. All offsets are from the start of the file.
+struct WjManifestHeader {
+    uint32_t magic;            // kManifestMagic
+    uint32_t version;          // kManifestVersion
+    uint32_t total_size;       // whole file, <= kManifestMaxSize
+    uint32_t abi_version;      // WJ_PLUGIN_ABI_VERSION of the plugin
+    uint32_t category;         // WjPluginCategory
+    uint32_t flags;            // WJ_PLUGIN_FLAG_* capability bits
+    uint32_t supports_hot_reload;
+    uint32_t dependency_count;
+    uint32_t name_off;
+    uint32_t version_off;
+    uint32_t description_off;
+    uint32_t author_off;
+    uint32_t license_off;
+    uint32_t deps_off;         // WjManifestDep[dependency_count]
+    uint32_t strtab_off;
+    uint32_t strtab_size;
+};
+static_assert(sizeof(WjManifestHeader) == 64, "manifest header layout is ABI");
+
+struct WjManifestDep {
+    uint32_t name_off;
+    uint32_t version_off;
+};
+
+// Parsed manifest, for tools and tests (the engine has its own reader)
+struct Manifest {
+    WjPluginInfo info;  // strings point into `strings` below
+    uint32_t abi_version = 0;
+    uint32_t flags = 0;
+    std::vector<WjPluginDependency> dependencies;
+    std::vector<char> strings;  // backing store for every const char*
+};
+
+namespace detail {
+
+inline uint32_t manifest_add_string(std::vector<char>& strtab, const char* s) {
+    uint32_t off = (uint32_t)strtab.size();
+    const char* src = s ? s : "";
+    strtab.insert(strtab.end(), src, src + std::strlen(src) + 1);
+    return off;
+}
+
+}  // namespace detail
+
+// Serialize plugin metadata into manifest bytes. Returns an empty
+// vector if the result would exceed kManifestMaxSize.
+inline std::vector<char> write_manifest(const WjPluginInfo& info,
+                                        uint32_t abi_version, uint32_t flags,
+                                        const WjPluginDependency* deps,
+                                        size_t dep_count) {
+    std::vector<char> strtab;
+    WjManifestHeader h = {};
+    h.magic = kManifestMagic;
+    h.version = kManifestVersion;
+    h.abi_version = abi_version;
+    h.category = (uint32_t)info.category;
+    h.flags = flags;
+    h.supports_hot_reload = info.supports_hot_reload ? 1 : 0;
+    h.dependency_count = (uint32_t)dep_count;
+    h.name_off = detail::manifest_add_string(strtab, info.name);
+    h.version_off = detail::manifest_add_string(strtab, info.version);
+    h.description_off = detail::manifest_add_string(strtab, info.description);
+    h.author_off = detail::manifest_add_string(strtab, info.author);
+    h.license_off = detail::manifest_add_string(strtab, info.license);
+
+    std::vector<WjManifestDep> dep_table(dep_count);
+    for (size_t i = 0; i < dep_count; i++) {
+        dep_table[i].name_off = detail::manifest_add_string(strtab, deps[i].name);
+        dep_table[i].version_off = detail::manifest_add_string(strtab, deps[i].version);
+    }
+
+    h.deps_off = sizeof(WjManifestHeader);
+    h.strtab_off = h.deps_off + (uint32_t)(dep_count * sizeof(WjManifestDep));
+    h.strtab_size = (uint32_t)strtab.size();
+    h.total_size = h.strtab_off + h.strtab_size;
+    if (h.total_size > kManifestMaxSize) return {};
+
+    std::vector<char> out(h.total_size);
+    std::memcpy(out.data(), &h, sizeof(h));
+    if (dep_count > 0) {
+        std::memcpy(out.data() + h.deps_off, dep_table.data(),
+                    dep_count * sizeof(WjManifestDep));
+    }
+    std::memcpy(out.data() + h.strtab_off, strtab.data(), strtab.size());
+    return out;
+}
+
+// Reference reader: parses and validates manifest bytes. Returns false
+// on any structural problem (bad magic, truncation, out-of-range
+// offsets, unterminated strings).
+inline bool read_manifest(const void* data, size_t size, Manifest* out) {
+    if (!data || !out || size < sizeof(WjManifestHeader)) return false;
+    WjManifestHeader h;
+    std::memcpy(&h, data, sizeof(h));
+    if (h.magic != kManifestMagic || h.version != kManifestVersion) return false;
+    if (h.total_size > size || h.total_size > kManifestMaxSize) return false;
+    // Compare with subtractions, never sums: uint32 sums of attacker-
+    // controlled offsets can wrap and sail past a != / > check
+    if (h.strtab_off > h.total_size) return false;
+    if (h.strtab_size != h.total_size - h.strtab_off) return false;
+    if (h.deps_off < sizeof(WjManifestHeader) || h.deps_off > h.strtab_off)
+        return false;
+    if (h.dependency_count >
+        (h.strtab_off - h.deps_off) / sizeof(WjManifestDep))
+        return false;
+
+    const char* bytes = static_cast<const char*>(data);
+    out->strings.assign(bytes + h.strtab_off, bytes + h.strtab_off + h.strtab_size);
+    if (!out->strings.empty() && out->strings.back() != '\0') return false;
+
+    auto str = [&](uint32_t off) -> const char* {
+        return off < out->strings.size() ? out->strings.data() + off : nullptr;
+    };
+    out->info.name = str(h.name_off);
+    out->info.version = str(h.version_off);
+    out->info.description = str(h.description_off);
+    out->info.author = str(h.author_off);
+    out->info.license = str(h.license_off);
+    out->info.category = (WjPluginCategory)h.category;
+    out->info.supports_hot_reload = h.supports_hot_reload != 0;
+    out->abi_version = h.abi_version;
+    out->flags = h.flags;
+    if (!out->info.name || !out->info.version) return false;
+
+    out->dependencies.resize(h.dependency_count);
+    for (uint32_t i = 0; i < h.dependency_count; i++) {
+        WjManifestDep d;
+        std::memcpy(&d, bytes + h.deps_off + i * sizeof(WjManifestDep), sizeof(d));
+        out->dependencies[i].name = str(d.name_off);
+        out->dependencies[i].version = str(d.version_off);
+        if (!out->dependencies[i].name || !out->dependencies[i].version) return false;
+    }
+    return true;
+}
+
+}  // namespace wj
+
+#endif  // WINDJAMMER_WJ_MANIFEST_HPP
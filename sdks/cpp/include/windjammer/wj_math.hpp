@@ -0,0 +1,288 @@
+// Windjammer C++ SDK — SIMD math types.
+//
+// Vec4, Mat4 (column-major), and Quat with a backend selected at
+// compile time from the target's instruction set:
+//
+//   WJ_MATH_SSE   x86 SSE2 (AVX widens the batch operations to 8 lanes)
+//   WJ_MATH_NEON  AArch64 / ARM NEON
+//   scalar        portable fallback, same results
+//
+// The batch operations (transform_points, multiply_matrices) are the
+// intended hot path: hand them whole arrays and they stream 4-8 floats
+// per instruction instead of calling the single-element ops in a loop.
+//
+// All types are 16-byte aligned PODs, safe to place in engine component
+// arrays and to pass across the plugin ABI by pointer.
+
+#ifndef WINDJAMMER_WJ_MATH_HPP
+#define WINDJAMMER_WJ_MATH_HPP
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE2__) || (defined(_M_X64) && !defined(_M_ARM64EC))
+#define WJ_MATH_SSE 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define WJ_MATH_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace wj {
+
+// ============================================================================
+// Vec4
+// ============================================================================
+
+struct alignas(16) Vec4 {
+#if defined(WJ_MATH_SSE)
+    __m128 v;
+
+    Vec4() = default;
+    Vec4(__m128 raw) : v(raw) {}
+    Vec4(float x, float y, float z, float w) : v(_mm_set_ps(w, z, y, x)) {}
+    static Vec4 splat(float s) { return Vec4(_mm_set1_ps(s)); }
+
+    float x() const { return _mm_cvtss_f32(v); }
+    float y() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, 0x55)); }
+    float z() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, 0xAA)); }
+    float w() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, 0xFF)); }
+
+    friend Vec4 operator+(Vec4 a, Vec4 b) { return Vec4(_mm_add_ps(a.v, b.v)); }
+    friend Vec4 operator-(Vec4 a, Vec4 b) { return Vec4(_mm_sub_ps(a.v, b.v)); }
+    friend Vec4 operator*(Vec4 a, Vec4 b) { return Vec4(_mm_mul_ps(a.v, b.v)); }
+    friend Vec4 operator*(Vec4 a, float s) { return Vec4(_mm_mul_ps(a.v, _mm_set1_ps(s))); }
+#elif defined(WJ_MATH_NEON)
+    float32x4_t v;
+
+    Vec4() = default;
+    Vec4(float32x4_t raw) : v(raw) {}
+    Vec4(float x, float y, float z, float w) {
+        const float tmp[4] = {x, y, z, w};
+        v = vld1q_f32(tmp);
+    }
+    static Vec4 splat(float s) { return Vec4(vdupq_n_f32(s)); }
+
+    float x() const { return vgetq_lane_f32(v, 0); }
+    float y() const { return vgetq_lane_f32(v, 1); }
+    float z() const { return vgetq_lane_f32(v, 2); }
+    float w() const { return vgetq_lane_f32(v, 3); }
+
+    friend Vec4 operator+(Vec4 a, Vec4 b) { return Vec4(vaddq_f32(a.v, b.v)); }
+    friend Vec4 operator-(Vec4 a, Vec4 b) { return Vec4(vsubq_f32(a.v, b.v)); }
+    friend Vec4 operator*(Vec4 a, Vec4 b) { return Vec4(vmulq_f32(a.v, b.v)); }
+    friend Vec4 operator*(Vec4 a, float s) { return Vec4(vmulq_n_f32(a.v, s)); }
+#else
+    float v[4];
+
+    Vec4() = default;
+    Vec4(float x, float y, float z, float w) : v{x, y, z, w} {}
+    static Vec4 splat(float s) { return Vec4(s, s, s, s); }
+
+    float x() const { return v[0]; }
+    float y() const { return v[1]; }
+    float z() const { return v[2]; }
+    float w() const { return v[3]; }
+
+    friend Vec4 operator+(Vec4 a, Vec4 b) {
+        return Vec4(a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]);
+    }
+    friend Vec4 operator-(Vec4 a, Vec4 b) {
+        return Vec4(a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]);
+    }
+    friend Vec4 operator*(Vec4 a, Vec4 b) {
+        return Vec4(a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]);
+    }
+    friend Vec4 operator*(Vec4 a, float s) {
+        return Vec4(a.v[0] * s, a.v[1] * s, a.v[2] * s, a.v[3] * s);
+    }
+#endif
+};
+
+// a * b + c, fused where the target has FMA
+inline Vec4 madd(Vec4 a, Vec4 b, Vec4 c) {
+#if defined(WJ_MATH_SSE) && defined(__FMA__)
+    return Vec4(_mm_fmadd_ps(a.v, b.v, c.v));
+#elif defined(WJ_MATH_NEON)
+    return Vec4(vmlaq_f32(c.v, a.v, b.v));
+#else
+    return a * b + c;
+#endif
+}
+
+inline float dot(Vec4 a, Vec4 b) {
+#if defined(WJ_MATH_SSE)
+    __m128 m = _mm_mul_ps(a.v, b.v);
+    __m128 s = _mm_add_ps(m, _mm_movehl_ps(m, m));       // x+z, y+w, -, -
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));       // x+z+y+w
+    return _mm_cvtss_f32(s);
+#elif defined(WJ_MATH_NEON)
+    float32x4_t m = vmulq_f32(a.v, b.v);
+    return vaddvq_f32(m);
+#else
+    return a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2] + a.v[3] * b.v[3];
+#endif
+}
+
+inline float dot3(Vec4 a, Vec4 b) {
+    return a.x() * b.x() + a.y() * b.y() + a.z() * b.z();
+}
+
+inline Vec4 cross3(Vec4 a, Vec4 b) {
+    return Vec4(a.y() * b.z() - a.z() * b.y(),
+                a.z() * b.x() - a.x() * b.z(),
+                a.x() * b.y() - a.y() * b.x(), 0.0f);
+}
+
+inline float length(Vec4 a) { return std::sqrt(dot(a, a)); }
+
+inline Vec4 normalize(Vec4 a) { return a * (1.0f / length(a)); }
+
+// ============================================================================
+// Mat4 (column-major, like the engine's transform storage)
+// ============================================================================
+
+struct alignas(16) Mat4 {
+    Vec4 c[4];  // columns
+
+    static Mat4 identity() {
+        Mat4 m;
+        m.c[0] = Vec4(1, 0, 0, 0);
+        m.c[1] = Vec4(0, 1, 0, 0);
+        m.c[2] = Vec4(0, 0, 1, 0);
+        m.c[3] = Vec4(0, 0, 0, 1);
+        return m;
+    }
+
+    static Mat4 translation(float x, float y, float z) {
+        Mat4 m = identity();
+        m.c[3] = Vec4(x, y, z, 1);
+        return m;
+    }
+
+    static Mat4 scale(float x, float y, float z) {
+        Mat4 m = identity();
+        m.c[0] = Vec4(x, 0, 0, 0);
+        m.c[1] = Vec4(0, y, 0, 0);
+        m.c[2] = Vec4(0, 0, z, 0);
+        return m;
+    }
+
+    static Mat4 rotation_z(float radians) {
+        const float s = std::sin(radians);
+        const float co = std::cos(radians);
+        Mat4 m = identity();
+        m.c[0] = Vec4(co, s, 0, 0);
+        m.c[1] = Vec4(-s, co, 0, 0);
+        return m;
+    }
+};
+
+// m * p: splat each component of p across a lane and accumulate columns
+// (four madds, no horizontal operations)
+inline Vec4 transform(const Mat4& m, Vec4 p) {
+    Vec4 r = m.c[0] * Vec4::splat(p.x());
+    r = madd(m.c[1], Vec4::splat(p.y()), r);
+    r = madd(m.c[2], Vec4::splat(p.z()), r);
+    r = madd(m.c[3], Vec4::splat(p.w()), r);
+    return r;
+}
+
+inline Mat4 operator*(const Mat4& a, const Mat4& b) {
+    Mat4 r;
+    r.c[0] = transform(a, b.c[0]);
+    r.c[1] = transform(a, b.c[1]);
+    r.c[2] = transform(a, b.c[2]);
+    r.c[3] = transform(a, b.c[3]);
+    return r;
+}
+
+// ============================================================================
+// Quat (x, y, z, w)
+// ============================================================================
+
+struct alignas(16) Quat {
+    Vec4 v;
+
+    Quat() = default;
+    Quat(float x, float y, float z, float w) : v(x, y, z, w) {}
+
+    static Quat identity() { return Quat(0, 0, 0, 1); }
+
+    static Quat from_axis_angle(Vec4 axis, float radians) {
+        const float h = radians * 0.5f;
+        const float s = std::sin(h);
+        Vec4 n = normalize(Vec4(axis.x(), axis.y(), axis.z(), 0));
+        return Quat(n.x() * s, n.y() * s, n.z() * s, std::cos(h));
+    }
+};
+
+inline Quat operator*(Quat a, Quat b) {
+    // Hamilton product expressed in Vec4 ops so each backend vectorizes it
+    Vec4 av(a.v.x(), a.v.y(), a.v.z(), 0);
+    Vec4 bv(b.v.x(), b.v.y(), b.v.z(), 0);
+    Vec4 vec = madd(av, Vec4::splat(b.v.w()),
+                    madd(bv, Vec4::splat(a.v.w()), cross3(av, bv)));
+    return Quat(vec.x(), vec.y(), vec.z(), a.v.w() * b.v.w() - dot3(av, bv));
+}
+
+// Rotate a point (w ignored) by q: v + 2 * cross(q.xyz, cross(q.xyz, v) + q.w * v)
+inline Vec4 rotate(Quat q, Vec4 p) {
+    Vec4 qv(q.v.x(), q.v.y(), q.v.z(), 0);
+    Vec4 t = cross3(qv, madd(p, Vec4::splat(q.v.w()), cross3(qv, p)));
+    return p + t * 2.0f;
+}
+
+// ============================================================================
+// Batch operations — the intended hot path
+// ============================================================================
+
+// out[i] = m * in[i]. With AVX this processes two points per iteration
+// through 256-bit lanes; otherwise four floats at a time.
+inline void transform_points(const Mat4& m, const Vec4* in, Vec4* out, size_t count) {
+    size_t i = 0;
+#if defined(WJ_MATH_SSE) && defined(__AVX__)
+    // Duplicate each matrix column across both 128-bit halves so two
+    // independent points ride in one 256-bit register
+    const __m256 c0 = _mm256_set_m128(m.c[0].v, m.c[0].v);
+    const __m256 c1 = _mm256_set_m128(m.c[1].v, m.c[1].v);
+    const __m256 c2 = _mm256_set_m128(m.c[2].v, m.c[2].v);
+    const __m256 c3 = _mm256_set_m128(m.c[3].v, m.c[3].v);
+    for (; i + 2 <= count; i += 2) {
+        // Vec4 guarantees 16-byte alignment, not 32 — unaligned load
+        __m256 p = _mm256_loadu_ps(reinterpret_cast<const float*>(in + i));
+        __m256 r = _mm256_mul_ps(c0, _mm256_shuffle_ps(p, p, 0x00));
+#if defined(__FMA__)
+        r = _mm256_fmadd_ps(c1, _mm256_shuffle_ps(p, p, 0x55), r);
+        r = _mm256_fmadd_ps(c2, _mm256_shuffle_ps(p, p, 0xAA), r);
+        r = _mm256_fmadd_ps(c3, _mm256_shuffle_ps(p, p, 0xFF), r);
+#else
+        r = _mm256_add_ps(r, _mm256_mul_ps(c1, _mm256_shuffle_ps(p, p, 0x55)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c2, _mm256_shuffle_ps(p, p, 0xAA)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c3, _mm256_shuffle_ps(p, p, 0xFF)));
+#endif
+        _mm256_storeu_ps(reinterpret_cast<float*>(out + i), r);
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = transform(m, in[i]);
+    }
+}
+
+// out[i] = a[i] * b[i]
+inline void multiply_matrices(const Mat4* a, const Mat4* b, Mat4* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+// out[i] = m * in[i] for a single shared left-hand matrix
+inline void multiply_matrices(const Mat4& m, const Mat4* in, Mat4* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = m * in[i];
+    }
+}
+
+}  // namespace wj
+
+#endif  // WINDJAMMER_WJ_MATH_HPP
@@ -0,0 +1,807 @@
+/* Windjammer Plugin ABI (C header)
+ *
+ * The stable C boundary between the Windjammer engine and native
+ * plugins. Everything here is plain C: fixed-layout structs, integer
+ * ids, and functions with C linkage. C++ plugins should prefer the
+ * zero-overhead wrappers in windjammer.hpp, which compile down to
+ * exactly these calls.
+ *
+ * Functions prefixed wj_app_/wj_arena_/wj_event_ are exported by the
+ * engine and resolved by the dynamic loader when the plugin is opened.
+ * Functions prefixed wj_plugin_ are exported by the plugin; the engine
+ * reaches them through the single wj_plugin_entry symbol.
+ */
+
+#ifndef WINDJAMMER_WJ_PLUGIN_ABI_H
+#define WINDJAMMER_WJ_PLUGIN_ABI_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#define WJ_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define WJ_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+#ifdef _MSC_VER
+#define WJ_ALIGN(n) __declspec(align(n))
+#else
+#define WJ_ALIGN(n) __attribute__((aligned(n)))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==========================================================================
+ * Core types
+ * ========================================================================== */
+
+/* Opaque handle to the Windjammer App */
+typedef struct WjApp WjApp;
+
+/* Plugin error codes */
+typedef enum WjPluginErrorCode {
+    WJ_OK = 0,
+    WJ_INVALID_PARAMETER = 1,
+    WJ_PLUGIN_NOT_FOUND = 2,
+    WJ_DEPENDENCY_ERROR = 3,
+    WJ_ALREADY_LOADED = 4,
+    WJ_LOAD_FAILED = 5,
+    WJ_UNLOAD_FAILED = 6,
+    WJ_VERSION_MISMATCH = 7,
+    WJ_CIRCULAR_DEPENDENCY = 8,
+} WjPluginErrorCode;
+
+/* Plugin categories */
+typedef enum WjPluginCategory {
+    WJ_CATEGORY_RENDERING = 0,
+    WJ_CATEGORY_PHYSICS = 1,
+    WJ_CATEGORY_AUDIO = 2,
+    WJ_CATEGORY_AI = 3,
+    WJ_CATEGORY_EDITOR = 4,
+    WJ_CATEGORY_ASSETS = 5,
+    WJ_CATEGORY_NETWORKING = 6,
+    WJ_CATEGORY_PLATFORM = 7,
+    WJ_CATEGORY_OTHER = 8,
+} WjPluginCategory;
+
+/* Plugin metadata */
+typedef struct WjPluginInfo {
+    const char* name;
+    const char* version;
+    const char* description;
+    const char* author;
+    const char* license;
+    WjPluginCategory category;
+    bool supports_hot_reload;
+} WjPluginInfo;
+
+/* Plugin dependency */
+typedef struct WjPluginDependency {
+    const char* name;
+    const char* version;
+} WjPluginDependency;
+
+/* Entity identifier (opaque to plugins) */
+typedef uint64_t WjEntityId;
+
+/* ==========================================================================
+ * Generational handles
+ * ========================================================================== */
+
+/* 64-bit generational handle to an engine object: low 32 bits index a
+ * slot in the engine's lock-free handle table, high 32 bits are the
+ * slot's generation. Resolution is one array index plus a generation
+ * compare; a handle to a destroyed (or relocated-and-recycled) object
+ * fails that compare and resolves to NULL instead of dangling. Because
+ * plugins hold handles rather than pointers, the engine is free to
+ * relocate or compact the underlying objects. */
+typedef uint64_t WjHandle;
+
+#define WJ_HANDLE_INVALID ((WjHandle)0)
+#define WJ_HANDLE_INDEX(h) ((uint32_t)(h))
+#define WJ_HANDLE_GENERATION(h) ((uint32_t)((h) >> 32))
+#define WJ_HANDLE_MAKE(index, generation) \
+    (((WjHandle)(generation) << 32) | (WjHandle)(uint32_t)(index))
+
+/* Resolve a handle to the object's current address, or NULL if stale.
+ * The address is only guaranteed until the plugin returns to the
+ * engine — re-resolve each entry, don't cache the pointer. */
+void* wj_handle_resolve(WjApp* app, WjHandle handle);
+
+/* Cheap liveness check without resolving */
+bool wj_handle_valid(WjApp* app, WjHandle handle);
+
+/* ==========================================================================
+ * String interning
+ * ========================================================================== */
+
+/* Stable 32-bit id for an interned string. Identity comparison on the
+ * hot path is an integer compare; the string's bytes cross the FFI
+ * boundary exactly once, at interning time. Ids are stable for the
+ * lifetime of the app and identical strings always intern to the same
+ * id, so ids can be exchanged between plugins. 0 is never valid. */
+typedef uint32_t WjStrId;
+
+#define WJ_STR_INVALID ((WjStrId)0)
+
+/* Intern a NUL-terminated string. Interning may take an engine lock —
+ * do it at init or when a name first appears, not per frame. */
+WjStrId wj_intern(WjApp* app, const char* str);
+
+/* Intern without requiring NUL termination */
+WjStrId wj_intern_len(WjApp* app, const char* str, size_t len);
+
+/* Reverse lookup for diagnostics and logging. The returned pointer is
+ * owned by the engine and stable for the app's lifetime; NULL for an
+ * unknown id. */
+const char* wj_str_lookup(WjApp* app, WjStrId id);
+
+/* ==========================================================================
+ * Zero-copy component access
+ * ========================================================================== */
+
+/* Component type identifier (assigned by the engine at registration) */
+typedef uint32_t WjComponentTypeId;
+
+/* Well-known component types registered by the engine core */
+typedef enum WjCoreComponent {
+    WJ_COMPONENT_TRANSFORM = 1,
+    WJ_COMPONENT_VELOCITY = 2,
+} WjCoreComponent;
+
+/* Direct view over an engine-owned component array. The plugin iterates
+ * engine memory in place — no copies cross the boundary. The view is
+ * valid for the current frame; if the engine relocates storage it bumps
+ * the generation, and stale views must be re-acquired. */
+typedef struct WjComponentView {
+    void* data;           /* base pointer into engine storage */
+    size_t stride;        /* bytes between consecutive elements */
+    size_t count;         /* number of live elements */
+    uint32_t generation;  /* bumped when the engine relocates storage */
+} WjComponentView;
+
+/* Acquire a read/write view over a component array. Pass writable=false
+ * for read-only access so the engine can skip change tracking. */
+WjPluginErrorCode wj_app_component_view(WjApp* app, WjComponentTypeId type,
+                                        bool writable, WjComponentView* out_view);
+
+/* ==========================================================================
+ * Chunked SoA queries
+ * ========================================================================== */
+
+/* A query walks every entity that has all the components in its
+ * signature, delivered as chunks: per-component contiguous SoA arrays
+ * of up to WJ_QUERY_CHUNK_CAPACITY entities, engine-aligned for direct
+ * vectorization. Per-entity gather through individual views is
+ * memory-bound; a chunk streams through the cache one dense block at a
+ * time. */
+
+#define WJ_QUERY_MAX_COMPONENTS 4
+#define WJ_QUERY_CHUNK_CAPACITY 128
+
+typedef struct WjQuery WjQuery;
+
+/* One chunk of matching entities. columns[i] is the dense array for
+ * the i-th component of the signature, in signature order; entities
+ * holds the chunk's entity ids, parallel to every column. Pointers are
+ * valid until the next wj_query_next call. */
+typedef struct WjQueryChunk {
+    uint32_t count;  /* entities in this chunk */
+    const WjEntityId* entities;
+    void* columns[WJ_QUERY_MAX_COMPONENTS];
+} WjQueryChunk;
+
+/* Compile a component signature into a query. Create once at init and
+ * reuse every frame — creation resolves the signature against the
+ * engine's archetypes; iteration does not. Returns NULL for an empty
+ * or oversized signature or an unregistered component type. */
+WjQuery* wj_query_create(WjApp* app, const WjComponentTypeId* types,
+                         size_t type_count, bool writable);
+
+void wj_query_destroy(WjApp* app, WjQuery* query);
+
+/* Fetch the next chunk. Returns false when iteration is complete and
+ * rewinds the query so the next call starts over (one query object per
+ * frame loop, no re-create). */
+bool wj_query_next(WjQuery* query, WjQueryChunk* out_chunk);
+
+/* ==========================================================================
+ * Frame pinning
+ * ========================================================================== */
+
+/* Double-buffered frame state for overlapped execution. At the end of
+ * each simulation frame the engine publishes an immutable snapshot of
+ * frame N-1; a plugin pins it with wj_frame_acquire and reads it on any
+ * thread while the engine builds frame N in the other buffer. Pinning
+ * is an atomic refcount — no locks on either side — and a pinned
+ * buffer is simply not reused until every pin is released. Analytics
+ * and replication plugins run fully overlapped with simulation this
+ * way. */
+
+/* An immutable, engine-owned snapshot of a completed frame */
+typedef struct WjFrameView WjFrameView;
+
+/* Pin the newest published frame. Returns NULL before the first frame
+ * has been published. Release promptly: a plugin that holds pins on
+ * both buffers stalls publication. */
+WjFrameView* wj_frame_acquire(WjApp* app);
+
+/* The frame number this snapshot captured */
+uint64_t wj_frame_number(const WjFrameView* view);
+
+/* Read-only component view into the pinned frame. Same shape as
+ * wj_app_component_view, but the data never changes while the pin is
+ * held — safe to read from worker threads without synchronization. */
+WjPluginErrorCode wj_frame_component_view(WjFrameView* view,
+                                          WjComponentTypeId type,
+                                          WjComponentView* out_view);
+
+/* Drop the pin. The view and every pointer obtained from it are
+ * invalid afterwards. */
+void wj_frame_release(WjApp* app, WjFrameView* view);
+
+/* ==========================================================================
+ * Frame arena
+ * ========================================================================== */
+
+/* Frame-scoped arena owned by WjApp. Allocation is a pointer bump with
+ * no per-allocation bookkeeping; the engine resets the arena between
+ * frames, freeing everything at once. Plugins should route transient
+ * per-frame data here instead of fighting the global allocator. */
+typedef struct WjArena WjArena;
+
+/* The calling plugin's per-frame arena (one per plugin, reset by the
+ * engine after wj_plugin_update returns) */
+WjArena* wj_app_frame_arena(WjApp* app);
+
+/* Bump-allocate size bytes with the given alignment. Returns NULL only
+ * if the arena is exhausted. Never freed individually. */
+void* wj_arena_alloc(WjArena* arena, size_t size, size_t align);
+
+/* Discard everything allocated since the last reset. Plugins normally
+ * never call this — the engine resets at the frame boundary. */
+void wj_arena_reset(WjArena* arena);
+
+/* ==========================================================================
+ * Plugin state pool
+ * ========================================================================== */
+
+/* Fixed-slot pool for plugin state objects, owned by the engine and
+ * keyed by interned plugin name. Slots for all plugins live in a few
+ * contiguous pages (fewer TLB misses on the frame loop than 30 states
+ * scattered across the heap), and a slot keeps its address across hot
+ * reloads: the reloaded library acquires the same key and gets the
+ * same bytes back, making reload allocation-free for trivially
+ * copyable state. */
+
+/* Acquire (or re-acquire) the slot for `key`. On first acquisition the
+ * slot is zeroed and *out_created is true; after a hot reload the
+ * existing bytes come back unchanged and *out_created is false.
+ * Returns NULL if the pool is exhausted or the size conflicts with an
+ * existing slot. */
+void* wj_state_acquire(WjApp* app, WjStrId key, size_t size, size_t align,
+                       bool* out_created);
+
+/* Return a slot to the pool (final unload, not hot reload) */
+void wj_state_release(WjApp* app, WjStrId key);
+
+/* ==========================================================================
+ * Plugin-to-engine events
+ * ========================================================================== */
+
+/* Fixed-size event record pushed from the plugin to the engine. POD so
+ * batches can be drained with memcpy; 32 bytes, two inline payload words. */
+typedef struct WjEvent {
+    uint32_t type;        /* plugin-defined event type */
+    uint32_t flags;
+    uint64_t subject;     /* typically an entity or asset id */
+    uint64_t payload[2];  /* inline payload, no indirection */
+} WjEvent;
+
+/* Single-producer single-consumer ring buffer between one plugin
+ * (producer) and the engine (consumer). Lock-free: pushes are a store
+ * plus a release write of the head index, and the engine drains whole
+ * batches on its side. No mutex, no per-event allocation. */
+typedef struct WjEventQueue WjEventQueue;
+
+/* Create this plugin's outbound event queue. Call once from
+ * wj_plugin_init; capacity is rounded up to a power of two. The engine
+ * owns the storage and destroys it at plugin unload. */
+WjEventQueue* wj_app_event_queue_create(WjApp* app, size_t capacity);
+
+/* Push one event. Returns false if the ring is full (the event is
+ * dropped — size the queue for your worst-case frame). */
+bool wj_event_push(WjEventQueue* queue, const WjEvent* event);
+
+/* Push a contiguous batch; returns how many were actually enqueued. */
+size_t wj_event_push_batch(WjEventQueue* queue, const WjEvent* events, size_t count);
+
+/* ==========================================================================
+ * Engine-to-plugin events
+ * ========================================================================== */
+
+/* The inbound direction: input, collisions, and lifecycle events flow
+ * from the engine to plugins by bulk polling, not callbacks — one
+ * boundary crossing per frame instead of one per event. */
+
+/* Well-known engine event types (plugins may also see game-defined
+ * types above WJ_EVENT_USER) */
+typedef enum WjEngineEventType {
+    WJ_EVENT_INPUT = 1,
+    WJ_EVENT_COLLISION = 2,
+    WJ_EVENT_ENTITY_SPAWNED = 3,
+    WJ_EVENT_ENTITY_DESPAWNED = 4,
+    WJ_EVENT_USER = 1024,
+} WjEngineEventType;
+
+/* Fixed-layout inbound event record: 32 bytes, 16-byte aligned, plain
+ * words throughout. A uniform array of these scans with SIMD — filter
+ * 100k events by type id with vector compares, no per-event branching
+ * on layout. */
+typedef struct WJ_ALIGN(16) WjEngineEvent {
+    uint32_t type;      /* WjEngineEventType or game-defined */
+    WjStrId subject;    /* interned id naming the subject (device, ...) */
+    uint64_t entity;    /* entity involved, or 0 */
+    uint64_t payload[2];
+} WjEngineEvent;
+
+/* Bulk-copy up to capacity pending events into the plugin's buffer and
+ * consume them; returns the number copied. Call once per update with a
+ * buffer sized for the worst case (align it to 16 for vector scans).
+ * Events that don't fit remain queued for the next poll. */
+size_t wj_events_poll(WjApp* app, WjEngineEvent* buffer, size_t capacity);
+
+/* ==========================================================================
+ * Structured errors
+ * ========================================================================== */
+
+/* Fixed-size error record, one per thread, written with plain stores.
+ * Reporting a failure from a per-frame callback costs a few stores —
+ * no formatting, no allocation, no iostream. The engine reads the
+ * calling thread's record when an entry point returns a non-WJ_OK code
+ * and resolves the interned source id only then, off the hot path. */
+typedef struct WjErrorRecord {
+    uint32_t code;    /* plugin-defined error code (0 = no error) */
+    WjStrId source;   /* interned id naming the failing subsystem/site */
+    int64_t arg0;     /* two integer details; meaning defined by source */
+    int64_t arg1;
+} WjErrorRecord;
+
+/* Overwrite the calling thread's error record */
+void wj_error_set(WjApp* app, uint32_t code, WjStrId source,
+                  int64_t arg0, int64_t arg1);
+
+/* Copy out and clear the calling thread's record; false if no error
+ * has been set since the last retrieval */
+bool wj_error_get(WjApp* app, WjErrorRecord* out);
+
+/* ==========================================================================
+ * Time
+ * ========================================================================== */
+
+/* Engine-published frame clock. The engine rewrites the fields once at
+ * each frame start; plugins read them with plain loads — no syscall,
+ * no vDSO, no boundary crossing. 32 bytes, one cache line with room to
+ * spare. */
+typedef struct WjFrameClock {
+    uint64_t frame;           /* monotonically increasing frame index */
+    uint64_t frame_start_ns;  /* engine time at the start of this frame */
+    double time_seconds;      /* seconds since app start, at frame start */
+    float delta_seconds;      /* previous frame's duration */
+    float reserved;
+} WjFrameClock;
+
+/* Pointer to the engine's frame clock. Stable for the app's lifetime —
+ * fetch once at init, then read fields directly every frame. For
+ * "how long until my timeout" logic this replaces clock_gettime
+ * entirely. */
+const WjFrameClock* wj_app_frame_clock(WjApp* app);
+
+/* Raw high-resolution ticks: a single rdtsc (x86) or counter read
+ * (ARM). For intervals within a frame; convert with wj_ticks_to_ns.
+ * Falls back to 0 on platforms without a cheap counter — use the frame
+ * clock there. */
+#if defined(__x86_64__) || defined(__i386__)
+static inline uint64_t wj_ticks(void) {
+    unsigned int lo, hi;
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+#elif defined(__aarch64__)
+static inline uint64_t wj_ticks(void) {
+    uint64_t v;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+}
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+static inline uint64_t wj_ticks(void) { return (uint64_t)__rdtsc(); }
+#else
+static inline uint64_t wj_ticks(void) { return 0; }
+#endif
+
+/* Convert a tick interval to nanoseconds using the engine's calibrated
+ * counter frequency (measured once at startup) */
+uint64_t wj_ticks_to_ns(WjApp* app, uint64_t ticks);
+
+/* ==========================================================================
+ * Deferred logging
+ * ========================================================================== */
+
+typedef enum WjLogLevel {
+    WJ_LOG_TRACE = 0,
+    WJ_LOG_DEBUG = 1,
+    WJ_LOG_INFO = 2,
+    WJ_LOG_WARN = 3,
+    WJ_LOG_ERROR = 4,
+} WjLogLevel;
+
+#define WJ_LOG_MAX_ARGS 3
+
+/* Fixed-size deferred log record: an interned format id plus raw
+ * argument words. POD, 32 bytes. The calling thread never formats and
+ * never touches a stream — wj_log copies this into a per-thread
+ * lock-free buffer and returns; an engine background thread resolves
+ * the format string, renders the arguments and does the I/O. */
+typedef struct WjLogRecord {
+    uint32_t level;                  /* WjLogLevel */
+    WjStrId format;                  /* interned format string */
+    uint64_t args[WJ_LOG_MAX_ARGS];  /* raw argument words */
+} WjLogRecord;
+
+/* Emit one log record. `format` is an interned string (intern once at
+ * init) whose placeholders select how each argument word is rendered:
+ * {} as unsigned decimal, {d} as signed decimal, {x} as hex, {f} as a
+ * double (bit pattern in the word), {s} as an interned string id.
+ * At most WJ_LOG_MAX_ARGS words; extras are dropped. Costs a few
+ * stores plus a release write on the hot path. */
+void wj_log(WjApp* app, WjLogLevel level, WjStrId format,
+            const uint64_t* args, uint32_t arg_count);
+
+/* ==========================================================================
+ * Profiling zones
+ * ========================================================================== */
+
+/* Nestable, thread-aware profiling zones, so engine-side profilers can
+ * attribute frame time to a specific plugin and zone instead of seeing
+ * one opaque block. Zone names are interned ids (intern once at init).
+ * Each begin/end writes a nanosecond timestamp into a per-thread
+ * lock-free buffer that the engine flushes off the hot path; when
+ * sampling is disabled both calls reduce to a couple of plain stores. */
+void wj_profile_zone_begin(WjApp* app, WjStrId zone);
+void wj_profile_zone_end(WjApp* app);
+
+/* ==========================================================================
+ * Asset streaming
+ * ========================================================================== */
+
+/* Read-only view over a memory-mapped region of an asset pack. The
+ * bytes are backed by the page cache, not a heap copy: mapping a
+ * multi-gigabyte pack costs address space, and only the pages the
+ * plugin actually touches become resident. */
+typedef struct WjAssetView {
+    const void* data;
+    size_t size;
+} WjAssetView;
+
+/* Map an asset (by logical path within the engine's asset packs) and
+ * hand back a zero-copy read-only view. Fails with WJ_PLUGIN_NOT_FOUND
+ * if no pack contains the asset. */
+WjPluginErrorCode wj_asset_map(WjApp* app, const char* path, WjAssetView* out_view);
+
+/* Release a mapping. Views must not outlive the plugin. */
+void wj_asset_unmap(WjApp* app, const WjAssetView* view);
+
+/* Hint that an asset will be mapped soon: the engine starts faulting
+ * the pages in from disk in the background. Purely advisory. */
+void wj_asset_prefetch(WjApp* app, const char* path);
+
+/* ==========================================================================
+ * Inter-plugin message bus
+ * ========================================================================== */
+
+/* Fixed-size message exchanged between plugins through the engine's
+ * bus. POD, 32 bytes; larger payloads belong in shared component
+ * storage or assets, with the message carrying an id. */
+typedef struct WjMessage {
+    WjStrId topic;        /* interned topic id (routing key) */
+    uint32_t flags;
+    uint64_t subject;     /* typically an entity or asset id */
+    uint64_t payload[2];  /* inline payload words */
+} WjMessage;
+
+/* A plugin's subscription to one topic: a bounded lock-free queue the
+ * bus fans matching messages into. Consume is wait-free for the owner;
+ * publishers on other threads never take a lock. When a queue is full
+ * further messages for that subscriber are dropped (size for the
+ * worst-case frame). */
+typedef struct WjSubscription WjSubscription;
+
+/* Subscribe to a topic. Queue storage (capacity rounded up to a power
+ * of two) is allocated once here — steady-state publish/consume never
+ * allocates. The engine destroys subscriptions at plugin unload. */
+WjSubscription* wj_bus_subscribe(WjApp* app, WjStrId topic, size_t capacity);
+
+/* Publish a batch; each message fans out to every subscription of its
+ * topic. Returns the number of messages accepted by all of their
+ * subscribers (partial delivery counts as not accepted). */
+size_t wj_bus_publish(WjApp* app, const WjMessage* messages, size_t count);
+
+/* Drain up to capacity messages from a subscription */
+size_t wj_bus_consume(WjSubscription* sub, WjMessage* out, size_t capacity);
+
+/* ==========================================================================
+ * Futures
+ * ========================================================================== */
+
+/* Handle to an engine future: a one-shot completion the engine signals
+ * (asset loaded, frame fence retired, timer elapsed). 0 is never
+ * valid. Futures are the resumption points for the coroutine support
+ * in wj_task.hpp, but are usable directly from C. */
+typedef uint64_t WjFuture;
+
+/* Completion callback, invoked exactly once on an engine worker
+ * thread when the future completes (immediately, inline, if it already
+ * has). */
+typedef void (*WjFutureCallback)(void* data, WjFuture future);
+
+/* Completes when the asset is resident (triggers the load if needed) */
+WjFuture wj_future_asset(WjApp* app, const char* path);
+
+/* Completes when frame `frame` has fully retired */
+WjFuture wj_future_frame_fence(WjApp* app, uint64_t frame);
+
+/* Completes after at least nanos of engine time */
+WjFuture wj_future_timer(WjApp* app, uint64_t nanos);
+
+/* Non-blocking completion check */
+bool wj_future_done(WjApp* app, WjFuture future);
+
+/* Register the one completion callback. Replaces polling entirely: a
+ * plugin waiting on ten futures costs nothing per frame. */
+void wj_future_then(WjApp* app, WjFuture future, WjFutureCallback cb, void* data);
+
+/* ==========================================================================
+ * Sprite batching
+ * ========================================================================== */
+
+/* One sprite instance, written by the plugin directly into the
+ * engine's persistently-mapped instance buffer. Fixed 48-byte layout
+ * matching the renderer's instance step rate. */
+typedef struct WjSpriteInstance {
+    float x, y;              /* world position */
+    float scale_x, scale_y;
+    float rotation;          /* radians */
+    float u0, v0, u1, v1;    /* texture rectangle */
+    uint32_t color;          /* RGBA8 tint */
+    uint32_t texture;        /* interned texture name (WjStrId) */
+    uint32_t _reserved;      /* pad to the 48-byte stride; write 0 */
+} WjSpriteInstance;
+
+#ifdef __cplusplus
+static_assert(sizeof(WjSpriteInstance) == 48, "sprite instance layout is ABI");
+#else
+_Static_assert(sizeof(WjSpriteInstance) == 48, "sprite instance layout is ABI");
+#endif
+
+/* A writable slice of the engine's persistently-mapped sprite instance
+ * buffer. The plugin writes instances in place — no staging copy on
+ * the plugin side, no copy on submit. */
+typedef struct WjSpriteBatch {
+    WjSpriteInstance* instances;  /* engine-owned mapped memory */
+    size_t capacity;              /* slots available in this slice */
+} WjSpriteBatch;
+
+/* Reserve capacity slots in the current frame's instance buffer. The
+ * slice stays writable until wj_sprites_commit or the end of the
+ * plugin's update, whichever comes first. */
+WjPluginErrorCode wj_sprites_acquire(WjApp* app, size_t capacity,
+                                     WjSpriteBatch* out_batch);
+
+/* Publish the first count instances of the slice: one boundary
+ * crossing per frame regardless of sprite count. Uncommitted slots are
+ * simply not drawn. */
+WjPluginErrorCode wj_sprites_commit(WjApp* app, const WjSpriteBatch* batch,
+                                    size_t count);
+
+/* ==========================================================================
+ * GPU staging ring
+ * ========================================================================== */
+
+/* Upload path for dynamic mesh and texture data: the engine keeps a
+ * persistently-mapped GPU staging ring, and plugins write into it
+ * directly. Generating 30 MB of terrain a frame is then one write into
+ * mapped memory — no plugin-side buffer and no second copy into the
+ * engine. Reuse is fence-based: the ring space behind a submission is
+ * handed back only after the GPU copy it fed has retired. */
+
+/* A writable slice of the staging ring. data is persistently-mapped,
+ * typically write-combined: write sequentially, don't read back. */
+typedef struct WjStagingSlice {
+    void* data;
+    size_t size;
+    uint64_t ticket;  /* engine bookkeeping; pass back to submit */
+} WjStagingSlice;
+
+/* Reserve size bytes of the ring. Returns false when the ring cannot
+ * fit the request until in-flight fences retire — either wait on an
+ * earlier submission's future or split the upload. Acquired slices
+ * must be submitted within the same update. */
+bool wj_staging_acquire(WjApp* app, size_t size, size_t align,
+                        WjStagingSlice* out_slice);
+
+/* Queue the slice for upload into the engine resource identified by
+ * destination (a WjHandle to a mesh/texture resource). Returns a
+ * future that completes when the GPU copy retires and the slice's ring
+ * space is reusable; 0 on invalid slice or destination. */
+WjFuture wj_staging_submit(WjApp* app, const WjStagingSlice* slice,
+                           WjHandle destination);
+
+/* ==========================================================================
+ * Job system
+ * ========================================================================== */
+
+/* Handle to a submitted job (or group of jobs). Zero is never a valid
+ * job. */
+typedef uint64_t WjJob;
+
+/* Job body. worker_index identifies the engine worker thread running
+ * the job (0..wj_app_worker_count-1), usable to index per-worker
+ * scratch without synchronization. */
+typedef void (*WjJobFn)(void* data, uint32_t worker_index);
+
+/* Body for a parallel-for slice: process [begin, end). The engine picks
+ * slice sizes so workers can steal halves of each other's remaining
+ * ranges. */
+typedef void (*WjParallelForFn)(void* data, size_t begin, size_t end,
+                                uint32_t worker_index);
+
+/* Number of engine worker threads available to plugin jobs */
+uint32_t wj_app_worker_count(WjApp* app);
+
+/* Submit one job to the engine's work-stealing scheduler. The job may
+ * start immediately on another worker; data must stay valid until the
+ * job is waited on. Returns 0 if the scheduler is saturated (run the
+ * work inline in that case). */
+WjJob wj_job_submit(WjApp* app, WjJobFn fn, void* data);
+
+/* Block until the job finishes. The calling thread steals and runs
+ * other jobs while it waits rather than sleeping. */
+void wj_job_wait(WjApp* app, WjJob job);
+
+/* Fan fn over [0, count) across all workers and wait for completion.
+ * grain is the smallest slice worth a steal (0 lets the engine pick).
+ * This is the one-call path for data-parallel plugin work: a physics
+ * broadphase over 80k entities is a single boundary crossing. */
+void wj_job_parallel_for(WjApp* app, size_t count, size_t grain,
+                         WjParallelForFn fn, void* data);
+
+/* ==========================================================================
+ * Resource accounting
+ * ========================================================================== */
+
+/* The engine maintains a block of cache-line-padded atomic counters
+ * per plugin, bumped with relaxed increments from the hot paths of the
+ * exported APIs — near-zero cost, always on. When a frame spike or
+ * memory creep hits production, wj_plugin_stats answers "which of the
+ * 30 loaded plugins is responsible" without bisecting by unload. */
+typedef struct WjPluginStats {
+    uint64_t arena_bytes;       /* total bytes bump-allocated from the
+                                 * plugin's frame arena */
+    uint64_t state_bytes;       /* bytes currently held in the state pool */
+    uint64_t staging_bytes;     /* bytes submitted through the staging ring */
+    uint64_t events_published;  /* outbound events plus bus messages */
+    uint64_t job_cpu_ns;        /* CPU time spent in the plugin's jobs */
+    uint64_t crossings;         /* calls into engine-exported functions */
+} WjPluginStats;
+
+/* Snapshot a plugin's counters. plugin is the interned plugin name, or
+ * WJ_STR_INVALID for the calling plugin. Returns false for an unknown
+ * plugin. */
+bool wj_plugin_stats(WjApp* app, WjStrId plugin, WjPluginStats* out_stats);
+
+/* ==========================================================================
+ * Frame batch
+ * ========================================================================== */
+
+/* A contiguous range of entities assigned to this plugin for the frame */
+typedef struct WjEntityRange {
+    const WjEntityId* entities;  /* dense array of entity ids */
+    size_t count;
+} WjEntityRange;
+
+/* Opaque command buffer: plugins record engine mutations here during
+ * update; the engine applies them after all plugins have run.
+ *
+ * Structural changes (spawn/despawn/add-component) are deliberately
+ * not immediate: recording appends a fixed-size command — and copies
+ * any component payload — into per-thread chunks bump-allocated from
+ * the frame arena, so recording from jobs needs no synchronization and
+ * a 5k-entity spawn burst is 5k appends. The engine applies every
+ * buffer at one sync point per frame; that is the only place entity
+ * storage is locked. */
+typedef struct WjCommandBuffer WjCommandBuffer;
+
+/* Spawned entities get a provisional id (high bit set) that later
+ * commands in the same frame may reference; the engine substitutes the
+ * real id at the sync point. */
+#define WJ_ENTITY_PROVISIONAL_BIT (1ull << 63)
+
+/* Record a spawn; returns the provisional id of the new entity */
+WjEntityId wj_cmd_spawn(WjCommandBuffer* cmds);
+
+/* Record a despawn (real or provisional id) */
+void wj_cmd_despawn(WjCommandBuffer* cmds, WjEntityId entity);
+
+/* Record adding a component: size bytes of data are copied into the
+ * buffer, so the source may be reused immediately. Returns false if
+ * the frame arena is exhausted. */
+bool wj_cmd_add_component(WjCommandBuffer* cmds, WjEntityId entity,
+                          WjComponentTypeId type, const void* data,
+                          size_t size);
+
+/* One frame's worth of work, handed to the plugin in a single FFI call.
+ * Batching the whole frame avoids a boundary crossing per entity/event. */
+typedef struct WjFrameBatch {
+    float delta_time;             /* seconds since the previous update */
+    uint64_t frame_number;        /* monotonically increasing frame index */
+    const WjEntityRange* ranges;  /* entity ranges assigned to this plugin */
+    size_t range_count;
+    WjCommandBuffer* commands;    /* deferred engine mutations */
+} WjFrameBatch;
+
+/* ==========================================================================
+ * Plugin entry points
+ * ========================================================================== */
+
+/* Hot-reload snapshot protocol. Before unloading a library the engine
+ * calls the plugin's snapshot entry; after loading the replacement it
+ * calls restore with the same bytes. The blob must be trivially
+ * copyable — entity ids and offsets, never pointers into plugin
+ * memory — so a reload is a single memcpy instead of a serialize/parse
+ * round trip. The engine first calls snapshot with buffer=NULL to query
+ * the size, then again with an engine-owned buffer of that size. */
+
+/* Versioned plugin function table. The engine resolves a single
+ * wj_plugin_entry symbol per plugin instead of one dlsym per entry
+ * point, and the whole table fits in one cache line. New entry points
+ * are appended and gated on abi_version; unused slots may be NULL. */
+#define WJ_PLUGIN_ABI_VERSION 1
+
+/* Capability flags for WjPluginVTable.flags */
+enum {
+    /* This plugin's init/cleanup touch no process-wide shared state, so
+     * the loader may run them concurrently with other plugins' init.
+     * The loader topologically sorts the graph declared through
+     * wj_plugin_dependencies and loads independent plugins in parallel
+     * across a thread pool; plugins without this flag are initialized
+     * serially at their topological level. Cycles and unsatisfied
+     * constraints still fail with WJ_CIRCULAR_DEPENDENCY and
+     * WJ_DEPENDENCY_ERROR. */
+    WJ_PLUGIN_FLAG_THREADSAFE_INIT = 1u << 0,
+};
+
+typedef struct WjPluginVTable {
+    uint32_t abi_version;  /* WJ_PLUGIN_ABI_VERSION the plugin was built with */
+    uint32_t flags;        /* WJ_PLUGIN_FLAG_* capability bits */
+    WjPluginInfo (*info)(void);
+    const WjPluginDependency* (*dependencies)(size_t* out_count);
+    WjPluginErrorCode (*init)(WjApp* app);
+    WjPluginErrorCode (*update)(WjApp* app, const WjFrameBatch* batch);
+    WjPluginErrorCode (*snapshot)(WjApp* app, void* buffer, size_t* size);
+    WjPluginErrorCode (*restore)(WjApp* app, const void* buffer, size_t size);
+    WjPluginErrorCode (*cleanup)(WjApp* app);
+} WjPluginVTable;
+
+/* The one symbol the engine looks up by name. The returned table must
+ * have static storage duration. */
+WJ_PLUGIN_EXPORT const WjPluginVTable* wj_plugin_entry(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* WINDJAMMER_WJ_PLUGIN_ABI_H */
@@ -0,0 +1,297 @@
+// Windjammer C++ SDK — cached plugin dependency resolution.
+//
+// Version constraints like the "^1.0.0" a plugin publishes in its
+// dependency table are strings; matching them as strings means parsing
+// on every compare, and re-solving the load order from scratch on every
+// startup is pure waste when the plugin set has not changed between
+// restarts of a fleet.
+//
+// Two pieces fix that:
+//
+//   1. compile_constraint() parses a constraint once into a half-open
+//      [min, max) range of packed integer versions, so every subsequent
+//      match is two 64-bit compares.
+//   2. ResolverCache persists a solved load order keyed by a hash of
+//      the whole plugin set (names, versions, constraints). A restart
+//      with an unchanged deployment re-reads the cache, compares one
+//      hash and skips resolution entirely; any change to the set misses
+//      the hash and falls through to a fresh solve.
+//
+// The serialized cache follows the .wjm pattern: a small fixed header
+// plus a table, read back with full validation.
+
+#ifndef WINDJAMMER_WJ_RESOLVER_HPP
+#define WINDJAMMER_WJ_RESOLVER_HPP
+
+#include <windjammer/wj_plugin_abi.h>
+
+#include <cstring>
+#include <vector>
+
+namespace wj {
+
+// ============================================================================
+// Packed versions and compiled constraints
+// ============================================================================
+
+// "major.minor.patch" packed as (major << 42) | (minor << 21) | patch,
+// 21 bits per component, so numeric version order is integer order.
+using PackedVersion = uint64_t;
+
+constexpr PackedVersion kVersionInvalid = ~(PackedVersion)0;
+constexpr uint64_t kVersionPartBits = 21;
+constexpr uint64_t kVersionPartMax = (1ull << kVersionPartBits) - 1;
+
+constexpr PackedVersion pack_version(uint64_t major, uint64_t minor,
+                                     uint64_t patch) {
+    return (major << (2 * kVersionPartBits)) | (minor << kVersionPartBits) |
+           patch;
+}
+
+// Parses "major.minor.patch". Returns kVersionInvalid on malformed
+// input or a component that overflows its 21 bits.
+constexpr PackedVersion parse_version(const char* v) {
+    uint64_t part[3] = {0, 0, 0};
+    int idx = 0;
+    int digits = 0;
+    for (; *v; ++v) {
+        if (*v == '.') {
+            if (digits == 0 || idx == 2) return kVersionInvalid;
+            ++idx;
+            digits = 0;
+        } else if (*v >= '0' && *v <= '9') {
+            part[idx] = part[idx] * 10 + (uint64_t)(*v - '0');
+            if (part[idx] > kVersionPartMax) return kVersionInvalid;
+            ++digits;
+        } else {
+            return kVersionInvalid;
+        }
+    }
+    if (idx != 2 || digits == 0) return kVersionInvalid;
+    return pack_version(part[0], part[1], part[2]);
+}
+
+// A constraint compiled to a half-open range: version v satisfies the
+// constraint iff min <= v < max. min > max means the constraint string
+// was malformed and matches nothing.
+struct CompiledConstraint {
+    PackedVersion min;
+    PackedVersion max;
+};
+
+constexpr bool constraint_matches(CompiledConstraint c, PackedVersion v) {
+    return c.min <= v && v < c.max;
+}
+
+// Compiles one constraint string. Supported forms, matching what
+// plugins actually publish:
+//
+//   "^1.2.3"   caret:  >= 1.2.3, < 2.0.0
+//              (semver 0.x rules apply: "^0.2.3" is < 0.3.0 and
+//               "^0.0.3" is < 0.0.4 — the leftmost nonzero part pins)
+//   "~1.2.3"   tilde:  >= 1.2.3, < 1.3.0
+//   ">=1.2.3"  floor:  >= 1.2.3
+//   "1.2.3"    exact:  == 1.2.3
+//   "*"        any
+constexpr CompiledConstraint compile_constraint(const char* c) {
+    constexpr CompiledConstraint invalid = {1, 0};
+    if (!c || *c == '\0') return invalid;
+    if (c[0] == '*' && c[1] == '\0') return {0, kVersionInvalid};
+
+    const char* num = c;
+    if (*num == '^' || *num == '~') ++num;
+    else if (num[0] == '>' && num[1] == '=') num += 2;
+
+    PackedVersion v = parse_version(num);
+    if (v == kVersionInvalid) return invalid;
+
+    uint64_t major = v >> (2 * kVersionPartBits);
+    uint64_t minor = (v >> kVersionPartBits) & kVersionPartMax;
+    switch (c[0]) {
+        case '^':
+            if (major == 0 && minor == 0) return {v, v + 1};
+            if (major == 0) return {v, pack_version(0, minor + 1, 0)};
+            return {v, pack_version(major + 1, 0, 0)};
+        case '~':
+            return {v, pack_version(major, minor + 1, 0)};
+        case '>':
+            return {v, kVersionInvalid};
+        default:
+            return {v, v + 1};
+    }
+}
+
+// ============================================================================
+// Load-order resolution
+// ============================================================================
+
+// One plugin as the resolver sees it: metadata plus its dependency
+// table, typically read from .wjm manifests.
+struct ResolverPlugin {
+    const char* name;
+    const char* version;
+    const WjPluginDependency* deps;
+    size_t dep_count;
+};
+
+// FNV-1a over the names, versions and constraint strings of the whole
+// set. Any change to the deployment — plugin added, removed, upgraded,
+// or a constraint edited — changes the hash.
+inline uint64_t plugin_set_hash(const ResolverPlugin* plugins, size_t count) {
+    uint64_t h = 1469598103934665603ull;
+    auto mix = [&h](const char* s) {
+        for (const char* p = s ? s : ""; ; ++p) {
+            h = (h ^ (uint64_t)(unsigned char)*p) * 1099511628211ull;
+            if (*p == '\0') break;  // fold the NUL so "ab"+"c" != "a"+"bc"
+        }
+    };
+    for (size_t i = 0; i < count; i++) {
+        mix(plugins[i].name);
+        mix(plugins[i].version);
+        for (size_t d = 0; d < plugins[i].dep_count; d++) {
+            mix(plugins[i].deps[d].name);
+            mix(plugins[i].deps[d].version);
+        }
+    }
+    return h;
+}
+
+// Solves a load order: every plugin after everything it depends on.
+// Constraints are compiled once up front; matching is integer compares.
+// Returns false on a missing dependency, a version that fails its
+// constraint, a malformed version/constraint string, or a cycle.
+// out_order receives indices into `plugins`.
+inline bool resolve_load_order(const ResolverPlugin* plugins, size_t count,
+                               std::vector<uint32_t>* out_order) {
+    if (!out_order) return false;
+    out_order->clear();
+
+    std::vector<PackedVersion> versions(count);
+    for (size_t i = 0; i < count; i++) {
+        versions[i] = parse_version(plugins[i].version);
+        if (versions[i] == kVersionInvalid) return false;
+    }
+
+    // Edges dep -> dependent, plus in-degree per plugin, for Kahn's
+    // algorithm. Plugin sets are small; linear name lookup is fine.
+    std::vector<std::vector<uint32_t>> dependents(count);
+    std::vector<uint32_t> in_degree(count, 0);
+    for (size_t i = 0; i < count; i++) {
+        for (size_t d = 0; d < plugins[i].dep_count; d++) {
+            const WjPluginDependency& dep = plugins[i].deps[d];
+            size_t target = count;
+            for (size_t j = 0; j < count; j++) {
+                if (std::strcmp(plugins[j].name, dep.name) == 0) {
+                    target = j;
+                    break;
+                }
+            }
+            if (target == count) return false;  // dependency not in the set
+            CompiledConstraint c = compile_constraint(dep.version);
+            if (!constraint_matches(c, versions[target])) return false;
+            dependents[target].push_back((uint32_t)i);
+            in_degree[i]++;
+        }
+    }
+
+    std::vector<uint32_t> ready;
+    for (size_t i = 0; i < count; i++) {
+        if (in_degree[i] == 0) ready.push_back((uint32_t)i);
+    }
+    while (!ready.empty()) {
+        uint32_t p = ready.back();
+        ready.pop_back();
+        out_order->push_back(p);
+        for (uint32_t dep : dependents[p]) {
+            if (--in_degree[dep] == 0) ready.push_back(dep);
+        }
+    }
+    if (out_order->size() != count) {
+        out_order->clear();
+        return false;  // cycle
+    }
+    return true;
+}
+
+// ============================================================================
+// Persistent resolution cache
+// ============================================================================
+
+// "WJRC", little-endian
+constexpr uint32_t kResolverCacheMagic = 0x43524A57u;
+constexpr uint32_t kResolverCacheVersion = 1;
+
+struct WjResolverCacheHeader {
+    uint32_t magic;       // kResolverCacheMagic
+    uint32_t version;     // kResolverCacheVersion
+    uint64_t set_hash;    // plugin_set_hash of the solved set
+    uint32_t count;       // entries in the order table that follows
+    uint32_t reserved;
+};
+static_assert(sizeof(WjResolverCacheHeader) == 24,
+              "resolver cache header layout is ABI");
+
+// A solved order and the hash of the set it was solved for
+struct ResolverCache {
+    uint64_t set_hash = 0;
+    std::vector<uint32_t> order;
+};
+
+// Serialize a cache for persistence next to the plugin directory
+inline std::vector<char> write_resolver_cache(const ResolverCache& cache) {
+    WjResolverCacheHeader h = {};
+    h.magic = kResolverCacheMagic;
+    h.version = kResolverCacheVersion;
+    h.set_hash = cache.set_hash;
+    h.count = (uint32_t)cache.order.size();
+
+    std::vector<char> out(sizeof(h) + cache.order.size() * sizeof(uint32_t));
+    std::memcpy(out.data(), &h, sizeof(h));
+    if (!cache.order.empty()) {
+        std::memcpy(out.data() + sizeof(h), cache.order.data(),
+                    cache.order.size() * sizeof(uint32_t));
+    }
+    return out;
+}
+
+// Validating reader. Returns false on bad magic, version, or truncation
+// — a corrupt or stale-format cache file just forces a fresh solve.
+inline bool read_resolver_cache(const void* data, size_t size,
+                                ResolverCache* out) {
+    if (!data || !out || size < sizeof(WjResolverCacheHeader)) return false;
+    WjResolverCacheHeader h;
+    std::memcpy(&h, data, sizeof(h));
+    if (h.magic != kResolverCacheMagic || h.version != kResolverCacheVersion)
+        return false;
+    if (size < sizeof(h) + (size_t)h.count * sizeof(uint32_t)) return false;
+    out->set_hash = h.set_hash;
+    out->order.resize(h.count);
+    if (h.count > 0) {
+        std::memcpy(out->order.data(), (const char*)data + sizeof(h),
+                    (size_t)h.count * sizeof(uint32_t));
+    }
+    return true;
+}
+
+// Resolve with a warm cache. If the cache was solved for exactly this
+// plugin set, the cached order is returned and no resolution runs;
+// otherwise the order is solved fresh and the cache updated for the
+// next startup. Returns false only when a fresh solve fails.
+inline bool resolve_cached(const ResolverPlugin* plugins, size_t count,
+                           ResolverCache* cache,
+                           std::vector<uint32_t>* out_order) {
+    if (!cache || !out_order) return false;
+    uint64_t hash = plugin_set_hash(plugins, count);
+    if (cache->set_hash == hash && cache->order.size() == count) {
+        *out_order = cache->order;
+        return true;
+    }
+    if (!resolve_load_order(plugins, count, out_order)) return false;
+    cache->set_hash = hash;
+    cache->order = *out_order;
+    return true;
+}
+
+}  // namespace wj
+
+#endif  // WINDJAMMER_WJ_RESOLVER_HPP
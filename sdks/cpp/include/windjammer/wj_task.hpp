@@ -0,0 +1,210 @@
+// Windjammer C++ SDK — C++20 coroutine tasks over engine futures.
+//
+// Lets a plugin write async work as straight-line code instead of a
+// hand-rolled state machine polled every frame:
+//
+//     wj::Task<void> load_level(wj::App app) {
+//         co_await wj::await_asset(app, "levels/forest.pack");
+//         co_await wj::await_frame(app, 120);   // frame fence
+//         co_await wj::await_timer(app, 16'000'000);
+//     }
+//
+// Suspension registers the coroutine handle with wj_future_then; the
+// engine resumes it on a worker when the future completes, so nothing
+// wakes up or polls while a task is pending. Tasks are lazy: they run
+// when first resumed (start()) or co_await-ed from another task, and
+// chained tasks resume each other by symmetric transfer.
+//
+// Requires C++20; the rest of the SDK stays C++17.
+
+#ifndef WINDJAMMER_WJ_TASK_HPP
+#define WINDJAMMER_WJ_TASK_HPP
+
+#if !defined(__cpp_impl_coroutine) && !(defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#error "wj_task.hpp requires C++20 coroutines; compile with -std=c++20"
+#endif
+
+#include <windjammer/windjammer.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace wj {
+
+// ============================================================================
+// Awaiting engine futures
+// ============================================================================
+
+// Awaiter over a raw WjFuture. Ready futures never suspend; otherwise
+// the coroutine handle rides through wj_future_then and the engine
+// resumes it on a worker.
+struct FutureAwaiter {
+    WjApp* app;
+    WjFuture future;
+
+    bool await_ready() const noexcept { return wj_future_done(app, future); }
+
+    void await_suspend(std::coroutine_handle<> h) const noexcept {
+        wj_future_then(
+            app, future,
+            [](void* data, WjFuture) {
+                std::coroutine_handle<>::from_address(data).resume();
+            },
+            h.address());
+    }
+
+    void await_resume() const noexcept {}
+};
+
+inline FutureAwaiter await_future(App app, WjFuture future) noexcept {
+    return FutureAwaiter{app.raw(), future};
+}
+
+// Completes when the asset is resident (triggers the load if needed)
+inline FutureAwaiter await_asset(App app, const char* path) noexcept {
+    return FutureAwaiter{app.raw(), wj_future_asset(app.raw(), path)};
+}
+
+// Completes when the given frame has fully retired
+inline FutureAwaiter await_frame(App app, uint64_t frame) noexcept {
+    return FutureAwaiter{app.raw(), wj_future_frame_fence(app.raw(), frame)};
+}
+
+// Completes after at least nanos of engine time
+inline FutureAwaiter await_timer(App app, uint64_t nanos) noexcept {
+    return FutureAwaiter{app.raw(), wj_future_timer(app.raw(), nanos)};
+}
+
+// ============================================================================
+// Task
+// ============================================================================
+
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+struct PromiseBase {
+    std::coroutine_handle<> continuation;  // resumed at final suspend
+    std::exception_ptr error;
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // Final suspend hands control straight to whoever co_await-ed this
+    // task (symmetric transfer: no stack growth, no scheduler hop)
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept {
+            std::coroutine_handle<> cont = h.promise().continuation;
+            return cont ? cont : std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+};
+
+template <typename T>
+struct Promise : PromiseBase {
+    T value;
+
+    Task<T> get_return_object() noexcept;
+    void return_value(T v) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        value = std::move(v);
+    }
+};
+
+template <>
+struct Promise<void> : PromiseBase {
+    Task<void> get_return_object() noexcept;
+    void return_void() noexcept {}
+};
+
+}  // namespace detail
+
+// Lazy coroutine task. The owning Task destroys the frame, so keep the
+// Task alive (e.g. as plugin state) until done() — typically until
+// cleanup for fire-and-forget work.
+template <typename T>
+class Task {
+public:
+    using promise_type = detail::Promise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Task() noexcept = default;
+    explicit Task(Handle h) noexcept : handle_(h) {}
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    Task(Task&& o) noexcept : handle_(std::exchange(o.handle_, {})) {}
+    Task& operator=(Task&& o) noexcept {
+        if (this != &o) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(o.handle_, {});
+        }
+        return *this;
+    }
+
+    ~Task() {
+        if (handle_) handle_.destroy();
+    }
+
+    explicit operator bool() const noexcept { return bool(handle_); }
+    bool done() const noexcept { return !handle_ || handle_.done(); }
+
+    // Kick off a root task (it runs until its first suspension; the
+    // engine resumes it from there)
+    void start() {
+        if (handle_ && !handle_.done()) handle_.resume();
+    }
+
+    // Awaiting a Task from another coroutine chains them: the inner
+    // task runs, and its completion resumes the outer one
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            Handle handle;
+            bool await_ready() const noexcept { return !handle || handle.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> cont) noexcept {
+                handle.promise().continuation = cont;
+                return handle;
+            }
+            T await_resume() {
+                if (handle.promise().error)
+                    std::rethrow_exception(handle.promise().error);
+                if constexpr (!std::is_void_v<T>)
+                    return std::move(handle.promise().value);
+            }
+        };
+        return Awaiter{handle_};
+    }
+
+    // Result of a finished task (rethrows if it failed)
+    T result() {
+        if (handle_.promise().error) std::rethrow_exception(handle_.promise().error);
+        if constexpr (!std::is_void_v<T>) return std::move(handle_.promise().value);
+    }
+
+private:
+    Handle handle_;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> Promise<T>::get_return_object() noexcept {
+    return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> Promise<void>::get_return_object() noexcept {
+    return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+}  // namespace detail
+
+}  // namespace wj
+
+#endif  // WINDJAMMER_WJ_TASK_HPP
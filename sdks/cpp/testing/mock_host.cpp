@@ -0,0 +1,1202 @@
+// In-process mock host: real implementations of the engine side of the
+// plugin ABI, minus the engine. See mock_host.h for the contract.
+
+#include "mock_host.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr size_t kArenaSize = 16u << 20;     // 16 MiB frame arena
+constexpr size_t kStatePoolSize = 1u << 20;  // 1 MiB plugin state pool
+constexpr size_t kStagingSize = 8u << 20;    // 8 MiB staging ring
+
+size_t round_up_pow2(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+}  // namespace
+
+// Frame arena: one contiguous block, allocation bumps an offset
+struct WjArena {
+    std::unique_ptr<char[]> storage;
+    size_t capacity = 0;
+    size_t offset = 0;
+    WjApp* owner = nullptr;  // accounting
+};
+
+// Lock-free SPSC ring. Producer (plugin) owns head, consumer (engine)
+// owns tail; each side publishes its index with a release store.
+struct WjEventQueue {
+    std::vector<WjEvent> slots;
+    size_t mask = 0;
+    std::atomic<uint64_t> head{0};  // next write (producer)
+    std::atomic<uint64_t> tail{0};  // next read (consumer)
+    WjApp* owner = nullptr;         // accounting
+};
+
+// Per-topic bounded queue (the real bus is MPMC; the mock reuses the
+// ring shape from WjEventQueue)
+struct WjSubscription {
+    WjStrId topic = WJ_STR_INVALID;
+    std::vector<WjMessage> slots;
+    size_t mask = 0;
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> tail{0};
+};
+
+struct MockComponentStore {
+    WjComponentTypeId type = 0;
+    void* data = nullptr;
+    size_t stride = 0;
+    size_t count = 0;
+};
+
+// Command buffer. The real engine gives each thread its own chunk; the
+// single-process mock records into one vector under a lock, with
+// payloads copied into the frame arena like the real thing.
+struct WjCommandBuffer {
+    WjApp* app = nullptr;
+    std::mutex mutex;
+    struct Cmd {
+        uint32_t kind;  // WJ_MOCK_CMD_*
+        WjEntityId entity;
+        WjComponentTypeId type;
+        const void* data;
+        size_t size;
+    };
+    std::vector<Cmd> cmds;
+    uint64_t next_provisional = 0;
+};
+
+// Immutable snapshot of one frame's component data. Pins are an atomic
+// refcount; a pinned buffer is never written.
+struct WjFrameView {
+    uint64_t frame = 0;
+    std::atomic<uint32_t> pins{0};
+    struct Column {
+        WjComponentTypeId type;
+        size_t stride;
+        size_t count;
+        std::vector<char> bytes;
+    };
+    std::vector<Column> columns;
+};
+
+struct WjApp {
+    WjArena frame_arena;
+    std::unique_ptr<WjEventQueue> events;
+    std::vector<MockComponentStore> components;
+    // Intern table: id = index + 1 into strings (0 stays invalid)
+    std::unordered_map<std::string, WjStrId> intern_ids;
+    std::vector<std::unique_ptr<std::string>> strings;  // stable addresses
+    std::mutex intern_mutex;
+    std::atomic<uint64_t> zones_entered{0};
+    std::vector<WjSpriteInstance> sprite_buffer;
+    uint64_t sprites_committed = 0;
+    // Futures: id = index + 1; completion driven by wj_mock_frame_end
+    // and wj_mock_advance_time
+    struct MockFuture {
+        enum Kind { kAsset, kFrameFence, kTimer } kind;
+        uint64_t target = 0;  // frame number or absolute nanoseconds
+        bool done = false;
+        WjFutureCallback cb = nullptr;
+        void* cb_data = nullptr;
+    };
+    std::vector<MockFuture> futures;
+    uint64_t now_ns = 0;
+    uint64_t frame = 0;
+    std::vector<std::unique_ptr<WjSubscription>> subscriptions;
+    struct HandleSlot {
+        void* object;
+        uint32_t generation;
+        bool alive;
+    };
+    std::vector<HandleSlot> handle_slots;
+    struct StateSlot {
+        WjStrId key;
+        size_t offset;
+        size_t size;
+    };
+    std::unique_ptr<char[]> state_pool;
+    size_t state_pool_used = 0;
+    std::vector<StateSlot> state_slots;
+    uint64_t next_entity = 1;  // real ids handed out at the sync point
+    uint64_t entities_spawned = 0;
+    WjFrameClock clock = {};
+    double ticks_per_ns = 0.0;  // calibrated on first wj_ticks_to_ns
+    // Resource counters (per plugin in the real engine; the mock has
+    // one plugin context). Padded to their own cache lines so relaxed
+    // hot-path bumps never false-share with neighbouring state.
+    struct alignas(64) MockStats {
+        std::atomic<uint64_t> arena_bytes{0};
+        std::atomic<uint64_t> state_bytes{0};
+        std::atomic<uint64_t> staging_bytes{0};
+        std::atomic<uint64_t> events_published{0};
+        std::atomic<uint64_t> job_cpu_ns{0};
+        std::atomic<uint64_t> crossings{0};
+    };
+    MockStats stats;
+    // Double-buffered frame snapshots; the non-pinned buffer receives
+    // the next publication (see wj_mock_frame_end)
+    std::unique_ptr<WjFrameView> frame_buffers[2];
+    int published_frame = -1;  // index into frame_buffers, -1 before first
+    // Staging ring: head/tail are monotonic byte cursors; regions
+    // between them retire in FIFO order as their fences complete
+    struct StagingRegion {
+        uint64_t begin;
+        uint64_t end;
+        uint64_t retire_frame;
+        bool submitted;
+    };
+    std::unique_ptr<char[]> staging_storage;
+    char* staging_base = nullptr;  // 64-byte aligned into staging_storage
+    uint64_t staging_head = 0;
+    uint64_t staging_tail = 0;
+    std::vector<StagingRegion> staging_inflight;
+    uint64_t staging_uploaded = 0;
+    // Inbound engine-event ring: wj_mock_events_inject produces,
+    // wj_events_poll bulk-consumes
+    std::vector<WjEngineEvent> in_events;
+    size_t in_mask = 0;
+    std::atomic<uint64_t> in_head{0};
+    std::atomic<uint64_t> in_tail{0};
+    // Deferred log ring (the real engine keeps one per thread; the
+    // single-process mock reuses the SPSC shape from WjEventQueue)
+    std::vector<WjLogRecord> log_slots;
+    size_t log_mask = 0;
+    std::atomic<uint64_t> log_head{0};
+    std::atomic<uint64_t> log_tail{0};
+};
+
+namespace {
+
+void mock_complete_due_futures(WjApp* app) {
+    // Index loop: a callback may create new futures while we iterate
+    for (size_t i = 0; i < app->futures.size(); i++) {
+        WjApp::MockFuture& f = app->futures[i];
+        if (f.done) continue;
+        bool due = (f.kind == WjApp::MockFuture::kFrameFence && app->frame >= f.target) ||
+                   (f.kind == WjApp::MockFuture::kTimer && app->now_ns >= f.target);
+        if (!due) continue;
+        f.done = true;
+        if (f.cb) {
+            WjFutureCallback cb = f.cb;
+            f.cb = nullptr;
+            cb(f.cb_data, (WjFuture)(i + 1));
+        }
+    }
+}
+
+}  // namespace
+
+extern "C" {
+
+// ---------------------------------------------------------------------------
+// Mock lifecycle
+// ---------------------------------------------------------------------------
+
+WjApp* wj_mock_app_create(void) {
+    WjApp* app = new WjApp();
+    app->frame_arena.storage.reset(new char[kArenaSize]);
+    app->frame_arena.capacity = kArenaSize;
+    app->frame_arena.owner = app;
+    app->state_pool.reset(new char[kStatePoolSize]);
+    app->staging_storage.reset(new char[kStagingSize + 64]);
+    app->staging_base = (char*)(((uintptr_t)app->staging_storage.get() + 63) &
+                                ~(uintptr_t)63);
+    return app;
+}
+
+void wj_mock_app_destroy(WjApp* app) {
+    if (!app) return;
+    // A pin released after this point would write into freed memory;
+    // fail loudly instead of corrupting the heap
+    for (const std::unique_ptr<WjFrameView>& buf : app->frame_buffers) {
+        if (buf && buf->pins.load(std::memory_order_acquire) != 0) {
+            std::fprintf(stderr,
+                         "wj_mock_app_destroy: frame view still pinned\n");
+            std::abort();
+        }
+    }
+    delete app;
+}
+
+void wj_mock_frame_end(WjApp* app) {
+    // Publish this frame's snapshot into whichever buffer is not
+    // pinned; if a plugin pins both, publication stalls (the previous
+    // snapshot simply stays current)
+    int target = (app->published_frame == 0) ? 1 : 0;
+    std::unique_ptr<WjFrameView>& buf = app->frame_buffers[target];
+    if (!buf || buf->pins.load(std::memory_order_acquire) == 0) {
+        if (!buf) buf.reset(new WjFrameView());
+        buf->frame = app->frame;
+        buf->columns.clear();
+        for (const MockComponentStore& s : app->components) {
+            WjFrameView::Column c;
+            c.type = s.type;
+            c.stride = s.stride;
+            c.count = s.count;
+            const char* bytes = (const char*)s.data;
+            c.bytes.assign(bytes, bytes + s.stride * s.count);
+            buf->columns.push_back(std::move(c));
+        }
+        app->published_frame = target;
+    }
+
+    wj_arena_reset(&app->frame_arena);
+    app->frame++;
+
+    // Publish the new frame's clock (plugins read these fields with
+    // plain loads through wj_app_frame_clock)
+    app->clock.delta_seconds =
+        (float)((double)(app->now_ns - app->clock.frame_start_ns) * 1e-9);
+    app->clock.frame = app->frame;
+    app->clock.frame_start_ns = app->now_ns;
+    app->clock.time_seconds = (double)app->now_ns * 1e-9;
+
+    mock_complete_due_futures(app);
+}
+
+void wj_mock_advance_time(WjApp* app, uint64_t nanos) {
+    app->now_ns += nanos;
+    mock_complete_due_futures(app);
+}
+
+void wj_mock_component_store(WjApp* app, WjComponentTypeId type,
+                             void* data, size_t stride, size_t count) {
+    app->components.push_back({type, data, stride, count});
+}
+
+void wj_mock_noop(WjApp* app) {
+    (void)app;
+}
+
+// Trivial per-element work, out of line in both shapes so the
+// benchmarks compare dispatch cost rather than inlining luck
+static uint64_t g_mock_sink;
+
+void wj_mock_process_one(WjApp* app, WjEntityId id) {
+    (void)app;
+    g_mock_sink += id;
+}
+
+void wj_mock_process_batch(WjApp* app, const WjEntityId* ids, size_t count) {
+    (void)app;
+    uint64_t acc = 0;
+    for (size_t i = 0; i < count; i++) acc += ids[i];
+    g_mock_sink += acc;
+}
+
+// ---------------------------------------------------------------------------
+// String interning
+// ---------------------------------------------------------------------------
+
+WjStrId wj_intern_len(WjApp* app, const char* str, size_t len) {
+    if (!app || !str) return WJ_STR_INVALID;
+    std::string key(str, len);
+    std::lock_guard<std::mutex> lock(app->intern_mutex);
+    auto it = app->intern_ids.find(key);
+    if (it != app->intern_ids.end()) return it->second;
+    app->strings.emplace_back(new std::string(key));
+    WjStrId id = (WjStrId)app->strings.size();  // index + 1; 0 stays invalid
+    app->intern_ids.emplace(std::move(key), id);
+    return id;
+}
+
+WjStrId wj_intern(WjApp* app, const char* str) {
+    return str ? wj_intern_len(app, str, std::strlen(str)) : WJ_STR_INVALID;
+}
+
+const char* wj_str_lookup(WjApp* app, WjStrId id) {
+    if (!app || id == WJ_STR_INVALID) return nullptr;
+    std::lock_guard<std::mutex> lock(app->intern_mutex);
+    if (id > app->strings.size()) return nullptr;
+    return app->strings[id - 1]->c_str();
+}
+
+// ---------------------------------------------------------------------------
+// Component views
+// ---------------------------------------------------------------------------
+
+WjPluginErrorCode wj_app_component_view(WjApp* app, WjComponentTypeId type,
+                                        bool writable, WjComponentView* out_view) {
+    (void)writable;
+    if (!app || !out_view) return WJ_INVALID_PARAMETER;
+    for (const MockComponentStore& s : app->components) {
+        if (s.type == type) {
+            out_view->data = s.data;
+            out_view->stride = s.stride;
+            out_view->count = s.count;
+            out_view->generation = 1;
+            return WJ_OK;
+        }
+    }
+    return WJ_INVALID_PARAMETER;
+}
+
+// ---------------------------------------------------------------------------
+// Command buffer (recording under a lock in the mock; applied by
+// wj_mock_commands_apply, the per-frame sync point)
+// ---------------------------------------------------------------------------
+
+WjEntityId wj_cmd_spawn(WjCommandBuffer* cmds) {
+    if (!cmds) return 0;
+    std::lock_guard<std::mutex> lock(cmds->mutex);
+    WjEntityId provisional = WJ_ENTITY_PROVISIONAL_BIT | ++cmds->next_provisional;
+    cmds->cmds.push_back({WJ_MOCK_CMD_SPAWN, provisional, 0, nullptr, 0});
+    return provisional;
+}
+
+void wj_cmd_despawn(WjCommandBuffer* cmds, WjEntityId entity) {
+    if (!cmds) return;
+    std::lock_guard<std::mutex> lock(cmds->mutex);
+    cmds->cmds.push_back({WJ_MOCK_CMD_DESPAWN, entity, 0, nullptr, 0});
+}
+
+bool wj_cmd_add_component(WjCommandBuffer* cmds, WjEntityId entity,
+                          WjComponentTypeId type, const void* data,
+                          size_t size) {
+    if (!cmds || !data || size == 0) return false;
+    void* copy = wj_arena_alloc(wj_app_frame_arena(cmds->app), size, 16);
+    if (!copy) return false;  // frame arena exhausted
+    std::memcpy(copy, data, size);
+    std::lock_guard<std::mutex> lock(cmds->mutex);
+    cmds->cmds.push_back({WJ_MOCK_CMD_ADD_COMPONENT, entity, type, copy, size});
+    return true;
+}
+
+WjCommandBuffer* wj_mock_commands_create(WjApp* app) {
+    WjCommandBuffer* cmds = new WjCommandBuffer();
+    cmds->app = app;
+    return cmds;
+}
+
+void wj_mock_commands_destroy(WjCommandBuffer* cmds) {
+    delete cmds;
+}
+
+size_t wj_mock_commands_drain(WjCommandBuffer* cmds, WjMockCommand* out,
+                              size_t capacity) {
+    std::lock_guard<std::mutex> lock(cmds->mutex);
+    size_t n = cmds->cmds.size() < capacity ? cmds->cmds.size() : capacity;
+    for (size_t i = 0; i < n; i++) {
+        const WjCommandBuffer::Cmd& c = cmds->cmds[i];
+        out[i] = {c.kind, c.entity, c.type, c.data, c.size};
+    }
+    return n;
+}
+
+size_t wj_mock_commands_apply(WjApp* app, WjCommandBuffer* cmds) {
+    std::lock_guard<std::mutex> lock(cmds->mutex);
+    size_t applied = cmds->cmds.size();
+    for (const WjCommandBuffer::Cmd& c : cmds->cmds) {
+        if (c.kind == WJ_MOCK_CMD_SPAWN) {
+            app->next_entity++;  // provisional id becomes this real one
+            app->entities_spawned++;
+        }
+    }
+    cmds->cmds.clear();
+    cmds->next_provisional = 0;
+    return applied;
+}
+
+uint64_t wj_mock_entities_spawned(WjApp* app) {
+    return app->entities_spawned;
+}
+
+// ---------------------------------------------------------------------------
+// Frame pinning (snapshots are copied out of the registered stores at
+// wj_mock_frame_end)
+// ---------------------------------------------------------------------------
+
+WjFrameView* wj_frame_acquire(WjApp* app) {
+    if (!app || app->published_frame < 0) return nullptr;
+    WjFrameView* view = app->frame_buffers[app->published_frame].get();
+    view->pins.fetch_add(1, std::memory_order_acquire);
+    return view;
+}
+
+uint64_t wj_frame_number(const WjFrameView* view) {
+    return view ? view->frame : 0;
+}
+
+WjPluginErrorCode wj_frame_component_view(WjFrameView* view,
+                                          WjComponentTypeId type,
+                                          WjComponentView* out_view) {
+    if (!view || !out_view) return WJ_INVALID_PARAMETER;
+    for (WjFrameView::Column& c : view->columns) {
+        if (c.type == type) {
+            out_view->data = c.bytes.data();
+            out_view->stride = c.stride;
+            out_view->count = c.count;
+            out_view->generation = 1;
+            return WJ_OK;
+        }
+    }
+    return WJ_INVALID_PARAMETER;
+}
+
+void wj_frame_release(WjApp* app, WjFrameView* view) {
+    (void)app;
+    if (view) view->pins.fetch_sub(1, std::memory_order_release);
+}
+
+// ---------------------------------------------------------------------------
+// Chunked queries (the mock chunks registered stores in place; entity
+// ids are the dense indices the real engine's archetypes would carry)
+// ---------------------------------------------------------------------------
+
+struct WjQuery {
+    WjApp* app = nullptr;
+    // Indices into app->components (stable across later registrations,
+    // unlike pointers into the vector)
+    size_t stores[WJ_QUERY_MAX_COMPONENTS] = {};
+    size_t type_count = 0;
+    size_t total = 0;   // min count across the signature's stores
+    size_t cursor = 0;  // next entity index
+    WjEntityId entity_scratch[WJ_QUERY_CHUNK_CAPACITY];
+};
+
+WjQuery* wj_query_create(WjApp* app, const WjComponentTypeId* types,
+                         size_t type_count, bool writable) {
+    (void)writable;
+    if (!app || !types || type_count == 0 ||
+        type_count > WJ_QUERY_MAX_COMPONENTS) {
+        return nullptr;
+    }
+    WjQuery* q = new WjQuery();
+    q->app = app;
+    q->type_count = type_count;
+    for (size_t i = 0; i < type_count; i++) {
+        size_t found = app->components.size();
+        for (size_t s = 0; s < app->components.size(); s++) {
+            if (app->components[s].type == types[i]) {
+                found = s;
+                break;
+            }
+        }
+        if (found == app->components.size()) {
+            delete q;
+            return nullptr;  // unregistered component type
+        }
+        q->stores[i] = found;
+        size_t count = app->components[found].count;
+        q->total = (i == 0) ? count : (count < q->total ? count : q->total);
+    }
+    return q;
+}
+
+void wj_query_destroy(WjApp* app, WjQuery* query) {
+    (void)app;
+    delete query;
+}
+
+bool wj_query_next(WjQuery* query, WjQueryChunk* out_chunk) {
+    if (!query || !out_chunk) return false;
+    if (query->cursor >= query->total) {
+        query->cursor = 0;  // rewind for the next frame's iteration
+        return false;
+    }
+    size_t start = query->cursor;
+    size_t n = query->total - start;
+    if (n > WJ_QUERY_CHUNK_CAPACITY) n = WJ_QUERY_CHUNK_CAPACITY;
+    for (size_t i = 0; i < n; i++) {
+        query->entity_scratch[i] = (WjEntityId)(start + i + 1);
+    }
+    out_chunk->count = (uint32_t)n;
+    out_chunk->entities = query->entity_scratch;
+    for (size_t i = 0; i < query->type_count; i++) {
+        const MockComponentStore& s = query->app->components[query->stores[i]];
+        out_chunk->columns[i] = (char*)s.data + start * s.stride;
+    }
+    for (size_t i = query->type_count; i < WJ_QUERY_MAX_COMPONENTS; i++) {
+        out_chunk->columns[i] = nullptr;
+    }
+    query->cursor = start + n;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Frame arena
+// ---------------------------------------------------------------------------
+
+WjArena* wj_app_frame_arena(WjApp* app) {
+    return &app->frame_arena;
+}
+
+void* wj_arena_alloc(WjArena* arena, size_t size, size_t align) {
+    size_t offset = (arena->offset + align - 1) & ~(align - 1);
+    if (offset + size > arena->capacity) return nullptr;
+    arena->offset = offset + size;
+    if (arena->owner) {
+        arena->owner->stats.arena_bytes.fetch_add(size, std::memory_order_relaxed);
+        arena->owner->stats.crossings.fetch_add(1, std::memory_order_relaxed);
+    }
+    return arena->storage.get() + offset;
+}
+
+void wj_arena_reset(WjArena* arena) {
+    arena->offset = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Plugin state pool (one contiguous block, slots keyed by name)
+// ---------------------------------------------------------------------------
+
+void* wj_state_acquire(WjApp* app, WjStrId key, size_t size, size_t align,
+                       bool* out_created) {
+    if (!app || key == WJ_STR_INVALID || size == 0) return nullptr;
+    for (WjApp::StateSlot& slot : app->state_slots) {
+        if (slot.key != key) continue;
+        if (slot.size != size) return nullptr;  // layout changed across reload
+        if (out_created) *out_created = false;
+        return app->state_pool.get() + slot.offset;
+    }
+    // Align the address, not just the offset: the pool base is only
+    // guaranteed new[] alignment
+    uintptr_t base = (uintptr_t)app->state_pool.get();
+    size_t offset =
+        ((base + app->state_pool_used + align - 1) & ~(uintptr_t)(align - 1)) -
+        base;
+    if (offset + size > kStatePoolSize) return nullptr;
+    app->state_pool_used = offset + size;
+    std::memset(app->state_pool.get() + offset, 0, size);
+    app->state_slots.push_back({key, offset, size});
+    app->stats.state_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (out_created) *out_created = true;
+    return app->state_pool.get() + offset;
+}
+
+void wj_state_release(WjApp* app, WjStrId key) {
+    if (!app) return;
+    for (size_t i = 0; i < app->state_slots.size(); i++) {
+        if (app->state_slots[i].key == key) {
+            app->stats.state_bytes.fetch_sub(app->state_slots[i].size,
+                                             std::memory_order_relaxed);
+            // Slot bookkeeping only; the mock never compacts the pool
+            app->state_slots.erase(app->state_slots.begin() + i);
+            return;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Event queue (SPSC)
+// ---------------------------------------------------------------------------
+
+WjEventQueue* wj_app_event_queue_create(WjApp* app, size_t capacity) {
+    if (!app || app->events) return app ? app->events.get() : nullptr;
+    app->events.reset(new WjEventQueue());
+    size_t cap = round_up_pow2(capacity ? capacity : 1);
+    app->events->slots.resize(cap);
+    app->events->mask = cap - 1;
+    app->events->owner = app;
+    return app->events.get();
+}
+
+bool wj_event_push(WjEventQueue* queue, const WjEvent* event) {
+    uint64_t head = queue->head.load(std::memory_order_relaxed);
+    uint64_t tail = queue->tail.load(std::memory_order_acquire);
+    if (head - tail > queue->mask) return false;  // full
+    queue->slots[head & queue->mask] = *event;
+    queue->head.store(head + 1, std::memory_order_release);
+    if (queue->owner) {
+        queue->owner->stats.events_published.fetch_add(1, std::memory_order_relaxed);
+        queue->owner->stats.crossings.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+size_t wj_event_push_batch(WjEventQueue* queue, const WjEvent* events, size_t count) {
+    uint64_t head = queue->head.load(std::memory_order_relaxed);
+    uint64_t tail = queue->tail.load(std::memory_order_acquire);
+    size_t free_slots = queue->mask + 1 - (size_t)(head - tail);
+    size_t n = count < free_slots ? count : free_slots;
+    for (size_t i = 0; i < n; i++) {
+        queue->slots[(head + i) & queue->mask] = events[i];
+    }
+    queue->head.store(head + n, std::memory_order_release);
+    if (queue->owner) {
+        queue->owner->stats.events_published.fetch_add(n, std::memory_order_relaxed);
+        queue->owner->stats.crossings.fetch_add(1, std::memory_order_relaxed);
+    }
+    return n;
+}
+
+size_t wj_mock_events_drain(WjApp* app, WjEvent* out, size_t capacity) {
+    WjEventQueue* queue = app->events.get();
+    if (!queue) return 0;
+    uint64_t tail = queue->tail.load(std::memory_order_relaxed);
+    uint64_t head = queue->head.load(std::memory_order_acquire);
+    size_t pending = (size_t)(head - tail);
+    size_t n = pending < capacity ? pending : capacity;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = queue->slots[(tail + i) & queue->mask];
+    }
+    queue->tail.store(tail + n, std::memory_order_release);
+    return n;
+}
+
+// ---------------------------------------------------------------------------
+// Engine-to-plugin events (same SPSC ring shape, reversed direction)
+// ---------------------------------------------------------------------------
+
+size_t wj_mock_events_inject(WjApp* app, const WjEngineEvent* events,
+                             size_t count) {
+    if (app->in_events.empty()) {
+        app->in_events.resize(4096);
+        app->in_mask = app->in_events.size() - 1;
+    }
+    uint64_t head = app->in_head.load(std::memory_order_relaxed);
+    uint64_t tail = app->in_tail.load(std::memory_order_acquire);
+    size_t free_slots = app->in_events.size() - (size_t)(head - tail);
+    size_t n = count < free_slots ? count : free_slots;
+    for (size_t i = 0; i < n; i++) {
+        app->in_events[(head + i) & app->in_mask] = events[i];
+    }
+    app->in_head.store(head + n, std::memory_order_release);
+    return n;
+}
+
+size_t wj_events_poll(WjApp* app, WjEngineEvent* buffer, size_t capacity) {
+    if (!app || !buffer || app->in_events.empty()) return 0;
+    uint64_t tail = app->in_tail.load(std::memory_order_relaxed);
+    uint64_t head = app->in_head.load(std::memory_order_acquire);
+    size_t pending = (size_t)(head - tail);
+    size_t n = pending < capacity ? pending : capacity;
+    for (size_t i = 0; i < n; i++) {
+        buffer[i] = app->in_events[(tail + i) & app->in_mask];
+    }
+    app->in_tail.store(tail + n, std::memory_order_release);
+    return n;
+}
+
+// ---------------------------------------------------------------------------
+// Structured errors
+// ---------------------------------------------------------------------------
+
+static thread_local WjErrorRecord g_error_record;
+static thread_local bool g_error_set;
+
+void wj_error_set(WjApp* app, uint32_t code, WjStrId source,
+                  int64_t arg0, int64_t arg1) {
+    (void)app;
+    g_error_record.code = code;
+    g_error_record.source = source;
+    g_error_record.arg0 = arg0;
+    g_error_record.arg1 = arg1;
+    g_error_set = true;
+}
+
+bool wj_error_get(WjApp* app, WjErrorRecord* out) {
+    (void)app;
+    if (!g_error_set) return false;
+    *out = g_error_record;
+    g_error_set = false;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Time (tick frequency calibrated against steady_clock on first use)
+// ---------------------------------------------------------------------------
+
+const WjFrameClock* wj_app_frame_clock(WjApp* app) {
+    return &app->clock;
+}
+
+uint64_t wj_ticks_to_ns(WjApp* app, uint64_t ticks) {
+    if (app->ticks_per_ns == 0.0) {
+        using steady = std::chrono::steady_clock;
+        uint64_t t0 = wj_ticks();
+        steady::time_point c0 = steady::now();
+        while (steady::now() - c0 < std::chrono::milliseconds(2)) {
+        }
+        uint64_t t1 = wj_ticks();
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        steady::now() - c0)
+                        .count();
+        if (t1 <= t0 || ns <= 0.0) return 0;  // no usable counter
+        app->ticks_per_ns = (double)(t1 - t0) / ns;
+    }
+    return (uint64_t)((double)ticks / app->ticks_per_ns);
+}
+
+// ---------------------------------------------------------------------------
+// Deferred logging
+// ---------------------------------------------------------------------------
+
+void wj_log(WjApp* app, WjLogLevel level, WjStrId format,
+            const uint64_t* args, uint32_t arg_count) {
+    if (!app || format == WJ_STR_INVALID) return;
+    if (app->log_slots.empty()) {
+        // Sized for the mock; the real engine allocates per thread
+        app->log_slots.resize(1024);
+        app->log_mask = app->log_slots.size() - 1;
+    }
+    uint64_t head = app->log_head.load(std::memory_order_relaxed);
+    uint64_t tail = app->log_tail.load(std::memory_order_acquire);
+    if (head - tail > app->log_mask) return;  // full: drop, never block
+
+    WjLogRecord& rec = app->log_slots[head & app->log_mask];
+    rec.level = (uint32_t)level;
+    rec.format = format;
+    if (arg_count > WJ_LOG_MAX_ARGS) arg_count = WJ_LOG_MAX_ARGS;
+    for (uint32_t i = 0; i < WJ_LOG_MAX_ARGS; i++) {
+        rec.args[i] = (i < arg_count && args) ? args[i] : 0;
+    }
+    app->log_head.store(head + 1, std::memory_order_release);
+}
+
+size_t wj_mock_log_drain(WjApp* app, WjLogRecord* out, size_t capacity) {
+    uint64_t tail = app->log_tail.load(std::memory_order_relaxed);
+    uint64_t head = app->log_head.load(std::memory_order_acquire);
+    size_t drained = 0;
+    while (tail != head && drained < capacity) {
+        out[drained++] = app->log_slots[tail & app->log_mask];
+        tail++;
+    }
+    app->log_tail.store(tail, std::memory_order_release);
+    return drained;
+}
+
+size_t wj_mock_log_format(WjApp* app, const WjLogRecord* rec,
+                          char* buf, size_t size) {
+    // Reference renderer for what the engine's logging thread does:
+    // resolve the interned format and substitute argument words
+    const char* fmt = wj_str_lookup(app, rec->format);
+    if (!fmt || size == 0) return 0;
+    size_t written = 0;
+    uint32_t arg = 0;
+    auto put = [&](const char* text) {
+        while (*text && written + 1 < size) buf[written++] = *text++;
+    };
+    for (const char* p = fmt; *p; p++) {
+        if (*p != '{' || arg >= WJ_LOG_MAX_ARGS) {
+            if (written + 1 < size) buf[written++] = *p;
+            continue;
+        }
+        char scratch[64];
+        uint64_t w = rec->args[arg];
+        if (p[1] == '}') {
+            std::snprintf(scratch, sizeof(scratch), "%llu",
+                          (unsigned long long)w);
+            p += 1;
+        } else if (p[1] == 'd' && p[2] == '}') {
+            std::snprintf(scratch, sizeof(scratch), "%lld", (long long)w);
+            p += 2;
+        } else if (p[1] == 'x' && p[2] == '}') {
+            std::snprintf(scratch, sizeof(scratch), "0x%llx",
+                          (unsigned long long)w);
+            p += 2;
+        } else if (p[1] == 'f' && p[2] == '}') {
+            double d;
+            std::memcpy(&d, &w, sizeof(d));
+            std::snprintf(scratch, sizeof(scratch), "%g", d);
+            p += 2;
+        } else if (p[1] == 's' && p[2] == '}') {
+            const char* s = wj_str_lookup(app, (WjStrId)w);
+            std::snprintf(scratch, sizeof(scratch), "%s", s ? s : "<bad-id>");
+            p += 2;
+        } else {
+            if (written + 1 < size) buf[written++] = *p;
+            continue;
+        }
+        put(scratch);
+        arg++;
+    }
+    buf[written] = '\0';
+    return written;
+}
+
+// ---------------------------------------------------------------------------
+// Profiling zones (the mock only counts; no trace buffer)
+// ---------------------------------------------------------------------------
+
+static thread_local int g_zone_depth;
+
+void wj_profile_zone_begin(WjApp* app, WjStrId zone) {
+    (void)zone;
+    g_zone_depth++;
+    app->zones_entered.fetch_add(1, std::memory_order_relaxed);
+}
+
+void wj_profile_zone_end(WjApp* app) {
+    (void)app;
+    g_zone_depth--;
+}
+
+uint64_t wj_mock_profile_zone_count(WjApp* app) {
+    return app->zones_entered.load(std::memory_order_relaxed);
+}
+
+int wj_mock_profile_zone_depth(WjApp* app) {
+    (void)app;
+    return g_zone_depth;
+}
+
+// ---------------------------------------------------------------------------
+// Asset streaming (the mock maps plain files by path)
+// ---------------------------------------------------------------------------
+
+WjPluginErrorCode wj_asset_map(WjApp* app, const char* path, WjAssetView* out_view) {
+    if (!app || !path || !out_view) return WJ_INVALID_PARAMETER;
+#if defined(_WIN32)
+    // Portability fallback: read into a heap buffer (still read-only to
+    // the plugin, just not zero-copy like the real engine)
+    FILE* f = std::fopen(path, "rb");
+    if (!f) return WJ_PLUGIN_NOT_FOUND;
+    std::fseek(f, 0, SEEK_END);
+    long size = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+    char* buf = static_cast<char*>(std::malloc((size_t)size));
+    size_t got = std::fread(buf, 1, (size_t)size, f);
+    std::fclose(f);
+    if ((long)got != size) {
+        std::free(buf);
+        return WJ_LOAD_FAILED;
+    }
+    out_view->data = buf;
+    out_view->size = (size_t)size;
+    return WJ_OK;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return WJ_PLUGIN_NOT_FOUND;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return WJ_LOAD_FAILED;
+    }
+    void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return WJ_LOAD_FAILED;
+    out_view->data = p;
+    out_view->size = (size_t)st.st_size;
+    return WJ_OK;
+#endif
+}
+
+void wj_asset_unmap(WjApp* app, const WjAssetView* view) {
+    (void)app;
+    if (!view || !view->data) return;
+#if defined(_WIN32)
+    std::free(const_cast<void*>(view->data));
+#else
+    munmap(const_cast<void*>(view->data), view->size);
+#endif
+}
+
+void wj_asset_prefetch(WjApp* app, const char* path) {
+    (void)app;
+#if defined(_WIN32)
+    (void)path;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        close(fd);
+    }
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Generational handles
+// ---------------------------------------------------------------------------
+
+WjHandle wj_mock_handle_alloc(WjApp* app, void* object) {
+    // Reuse a free slot (bumping its generation) before growing
+    for (size_t i = 0; i < app->handle_slots.size(); i++) {
+        if (!app->handle_slots[i].alive) {
+            app->handle_slots[i].alive = true;
+            app->handle_slots[i].object = object;
+            app->handle_slots[i].generation++;
+            return WJ_HANDLE_MAKE(i, app->handle_slots[i].generation);
+        }
+    }
+    app->handle_slots.push_back({object, 1, true});
+    return WJ_HANDLE_MAKE(app->handle_slots.size() - 1, 1);
+}
+
+void wj_mock_handle_free(WjApp* app, WjHandle handle) {
+    uint32_t index = WJ_HANDLE_INDEX(handle);
+    if (index < app->handle_slots.size() &&
+        app->handle_slots[index].generation == WJ_HANDLE_GENERATION(handle)) {
+        app->handle_slots[index].alive = false;
+        app->handle_slots[index].object = nullptr;
+    }
+}
+
+void* wj_handle_resolve(WjApp* app, WjHandle handle) {
+    uint32_t index = WJ_HANDLE_INDEX(handle);
+    if (!app || index >= app->handle_slots.size()) return nullptr;
+    const WjApp::HandleSlot& slot = app->handle_slots[index];
+    if (!slot.alive || slot.generation != WJ_HANDLE_GENERATION(handle))
+        return nullptr;
+    return slot.object;
+}
+
+bool wj_handle_valid(WjApp* app, WjHandle handle) {
+    return wj_handle_resolve(app, handle) != nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// Message bus
+// ---------------------------------------------------------------------------
+
+size_t wj_bus_publish(WjApp* app, const WjMessage* messages, size_t count) {
+    size_t accepted = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool delivered_everywhere = true;
+        for (auto& sub : app->subscriptions) {
+            if (sub->topic != messages[i].topic) continue;
+            uint64_t head = sub->head.load(std::memory_order_relaxed);
+            uint64_t tail = sub->tail.load(std::memory_order_acquire);
+            if (head - tail > sub->mask) {
+                delivered_everywhere = false;  // full: drop for this sub
+                continue;
+            }
+            sub->slots[head & sub->mask] = messages[i];
+            sub->head.store(head + 1, std::memory_order_release);
+        }
+        if (delivered_everywhere) accepted++;
+    }
+    app->stats.events_published.fetch_add(accepted, std::memory_order_relaxed);
+    app->stats.crossings.fetch_add(1, std::memory_order_relaxed);
+    return accepted;
+}
+
+WjSubscription* wj_bus_subscribe(WjApp* app, WjStrId topic, size_t capacity) {
+    if (!app || topic == WJ_STR_INVALID || capacity == 0) return nullptr;
+    app->subscriptions.emplace_back(new WjSubscription());
+    WjSubscription* sub = app->subscriptions.back().get();
+    size_t cap = round_up_pow2(capacity);
+    sub->topic = topic;
+    sub->slots.resize(cap);
+    sub->mask = cap - 1;
+    return sub;
+}
+
+size_t wj_bus_consume(WjSubscription* sub, WjMessage* out, size_t capacity) {
+    if (!sub || !out) return 0;
+    uint64_t tail = sub->tail.load(std::memory_order_relaxed);
+    uint64_t head = sub->head.load(std::memory_order_acquire);
+    size_t pending = (size_t)(head - tail);
+    size_t n = pending < capacity ? pending : capacity;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = sub->slots[(tail + i) & sub->mask];
+    }
+    sub->tail.store(tail + n, std::memory_order_release);
+    return n;
+}
+
+// ---------------------------------------------------------------------------
+// Futures (asset loads resolve synchronously in the mock)
+// ---------------------------------------------------------------------------
+
+static WjFuture mock_future_add(WjApp* app, WjApp::MockFuture f) {
+    app->futures.push_back(f);
+    return (WjFuture)app->futures.size();
+}
+
+WjFuture wj_future_asset(WjApp* app, const char* path) {
+    (void)path;  // mock "loads" instantly
+    WjApp::MockFuture f;
+    f.kind = WjApp::MockFuture::kAsset;
+    f.done = true;
+    return mock_future_add(app, f);
+}
+
+WjFuture wj_future_frame_fence(WjApp* app, uint64_t frame) {
+    WjApp::MockFuture f;
+    f.kind = WjApp::MockFuture::kFrameFence;
+    f.target = frame;
+    f.done = app->frame >= frame;
+    return mock_future_add(app, f);
+}
+
+WjFuture wj_future_timer(WjApp* app, uint64_t nanos) {
+    WjApp::MockFuture f;
+    f.kind = WjApp::MockFuture::kTimer;
+    f.target = app->now_ns + nanos;
+    f.done = nanos == 0;
+    return mock_future_add(app, f);
+}
+
+bool wj_future_done(WjApp* app, WjFuture future) {
+    if (future == 0 || future > app->futures.size()) return false;
+    return app->futures[future - 1].done;
+}
+
+void wj_future_then(WjApp* app, WjFuture future, WjFutureCallback cb, void* data) {
+    if (future == 0 || future > app->futures.size() || !cb) return;
+    WjApp::MockFuture& f = app->futures[future - 1];
+    if (f.done) {
+        cb(data, future);  // already complete: resume inline
+    } else {
+        f.cb = cb;
+        f.cb_data = data;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Sprite batching (one heap-backed "mapped" buffer per frame)
+// ---------------------------------------------------------------------------
+
+WjPluginErrorCode wj_sprites_acquire(WjApp* app, size_t capacity,
+                                     WjSpriteBatch* out_batch) {
+    if (!app || !out_batch || capacity == 0) return WJ_INVALID_PARAMETER;
+    app->sprite_buffer.resize(capacity);
+    out_batch->instances = app->sprite_buffer.data();
+    out_batch->capacity = capacity;
+    return WJ_OK;
+}
+
+WjPluginErrorCode wj_sprites_commit(WjApp* app, const WjSpriteBatch* batch,
+                                    size_t count) {
+    if (!app || !batch || count > batch->capacity) return WJ_INVALID_PARAMETER;
+    app->sprites_committed += count;
+    return WJ_OK;
+}
+
+uint64_t wj_mock_sprites_committed(WjApp* app) {
+    return app->sprites_committed;
+}
+
+// ---------------------------------------------------------------------------
+// GPU staging ring (heap-backed "mapped" memory; fences are frame
+// fences, retired by wj_mock_frame_end)
+// ---------------------------------------------------------------------------
+
+bool wj_staging_acquire(WjApp* app, size_t size, size_t align,
+                        WjStagingSlice* out_slice) {
+    if (!app || !out_slice || size == 0 || size > kStagingSize) return false;
+    if (align == 0) align = 16;
+    if (align > 64) align = 64;  // the mock's base alignment
+
+    // Retire regions whose fences have completed, in FIFO order
+    while (!app->staging_inflight.empty()) {
+        const WjApp::StagingRegion& r = app->staging_inflight.front();
+        if (!r.submitted || app->frame < r.retire_frame) break;
+        app->staging_tail = r.end;
+        app->staging_inflight.erase(app->staging_inflight.begin());
+    }
+
+    uint64_t head = (app->staging_head + align - 1) & ~(uint64_t)(align - 1);
+    size_t offset = (size_t)(head % kStagingSize);
+    if (offset + size > kStagingSize) head += kStagingSize - offset;  // wrap
+    if (head + size - app->staging_tail > kStagingSize) return false;
+
+    // Alignment/wrap padding retires with the next frame's fences
+    if (head > app->staging_head) {
+        app->staging_inflight.push_back(
+            {app->staging_head, head, app->frame + 1, true});
+    }
+    out_slice->data = app->staging_base + (size_t)(head % kStagingSize);
+    out_slice->size = size;
+    out_slice->ticket = head;
+    app->staging_inflight.push_back({head, head + size, 0, false});
+    app->staging_head = head + size;
+    return true;
+}
+
+WjFuture wj_staging_submit(WjApp* app, const WjStagingSlice* slice,
+                           WjHandle destination) {
+    if (!app || !slice || !slice->data) return 0;
+    if (!wj_handle_valid(app, destination)) return 0;
+    for (WjApp::StagingRegion& r : app->staging_inflight) {
+        if (r.begin == slice->ticket && !r.submitted) {
+            // The "GPU" consumes this frame's uploads by the next one
+            r.submitted = true;
+            r.retire_frame = app->frame + 1;
+            app->staging_uploaded += slice->size;
+            app->stats.staging_bytes.fetch_add(slice->size,
+                                               std::memory_order_relaxed);
+            app->stats.crossings.fetch_add(1, std::memory_order_relaxed);
+            return wj_future_frame_fence(app, app->frame + 1);
+        }
+    }
+    return 0;  // unknown or already-submitted ticket
+}
+
+uint64_t wj_mock_staging_uploaded(WjApp* app) {
+    return app->staging_uploaded;
+}
+
+// ---------------------------------------------------------------------------
+// Jobs (inline: the mock has no worker threads)
+// ---------------------------------------------------------------------------
+
+uint32_t wj_app_worker_count(WjApp* app) {
+    (void)app;
+    return 1;
+}
+
+WjJob wj_job_submit(WjApp* app, WjJobFn fn, void* data) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    fn(data, 0);
+    app->stats.job_cpu_ns.fetch_add(
+        (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count(),
+        std::memory_order_relaxed);
+    app->stats.crossings.fetch_add(1, std::memory_order_relaxed);
+    return 1;  // already complete
+}
+
+void wj_job_wait(WjApp* app, WjJob job) {
+    (void)app;
+    (void)job;
+}
+
+void wj_job_parallel_for(WjApp* app, size_t count, size_t grain,
+                         WjParallelForFn fn, void* data) {
+    (void)grain;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (count > 0) fn(data, 0, count, 0);
+    app->stats.job_cpu_ns.fetch_add(
+        (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count(),
+        std::memory_order_relaxed);
+    app->stats.crossings.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ---------------------------------------------------------------------------
+// Resource accounting
+// ---------------------------------------------------------------------------
+
+bool wj_plugin_stats(WjApp* app, WjStrId plugin, WjPluginStats* out_stats) {
+    if (!app || !out_stats) return false;
+    // The mock has a single plugin context; any known key (or
+    // WJ_STR_INVALID for "the calling plugin") maps to it
+    if (plugin != WJ_STR_INVALID && !wj_str_lookup(app, plugin)) return false;
+    const WjApp::MockStats& s = app->stats;
+    out_stats->arena_bytes = s.arena_bytes.load(std::memory_order_relaxed);
+    out_stats->state_bytes = s.state_bytes.load(std::memory_order_relaxed);
+    out_stats->staging_bytes = s.staging_bytes.load(std::memory_order_relaxed);
+    out_stats->events_published =
+        s.events_published.load(std::memory_order_relaxed);
+    out_stats->job_cpu_ns = s.job_cpu_ns.load(std::memory_order_relaxed);
+    out_stats->crossings = s.crossings.load(std::memory_order_relaxed);
+    return true;
+}
+
+}  // extern "C"
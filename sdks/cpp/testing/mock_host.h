@@ -0,0 +1,110 @@
+/* Windjammer C++ SDK — in-process mock host.
+ *
+ * Implements the engine side of the plugin ABI inside the plugin's own
+ * process, so SDK examples, benchmarks, and plugin unit tests can run
+ * without a live engine. The implementations are real (the event queue
+ * is an actual lock-free SPSC ring, the arena really bumps a pointer)
+ * but single-process: jobs run inline on the calling thread.
+ *
+ * Link the wj_mock_host static library to get both these helpers and
+ * the wj_app_* / wj_arena_* / wj_event_* / wj_job_* symbols a plugin
+ * normally resolves from the host binary.
+ */
+
+#ifndef WINDJAMMER_TESTING_MOCK_HOST_H
+#define WINDJAMMER_TESTING_MOCK_HOST_H
+
+#include <windjammer/wj_plugin_abi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Create/destroy a mock app. The frame arena is 16 MiB. */
+WjApp* wj_mock_app_create(void);
+void wj_mock_app_destroy(WjApp* app);
+
+/* What the engine does at the end of a frame: resets the frame arena,
+ * advances the frame counter, and completes due frame-fence futures */
+void wj_mock_frame_end(WjApp* app);
+
+/* Advance the mock clock and complete due timer futures */
+void wj_mock_advance_time(WjApp* app, uint64_t nanos);
+
+/* Engine-side drain of the plugin's event queue; returns events copied */
+size_t wj_mock_events_drain(WjApp* app, WjEvent* out, size_t capacity);
+
+/* Engine-side injection into the inbound event ring consumed by
+ * wj_events_poll; returns events accepted (the ring may fill) */
+size_t wj_mock_events_inject(WjApp* app, const WjEngineEvent* events,
+                             size_t count);
+
+/* Register backing storage for a component type so
+ * wj_app_component_view has something to hand out */
+void wj_mock_component_store(WjApp* app, WjComponentTypeId type,
+                             void* data, size_t stride, size_t count);
+
+/* No-op call across the (simulated) boundary. Defined in a separate
+ * translation unit so benchmarks measure a real out-of-line call. */
+void wj_mock_noop(WjApp* app);
+
+/* Register an object in the handle table / retire its slot (the real
+ * engine does this as objects are created and destroyed) */
+WjHandle wj_mock_handle_alloc(WjApp* app, void* object);
+void wj_mock_handle_free(WjApp* app, WjHandle handle);
+
+/* Command-buffer introspection. The mock records commands verbatim;
+ * drain copies the engine-side view without consuming, apply is the
+ * per-frame sync point (assigns real ids for spawns, clears the
+ * buffer, returns commands applied). */
+#define WJ_MOCK_CMD_SPAWN 0u
+#define WJ_MOCK_CMD_DESPAWN 1u
+#define WJ_MOCK_CMD_ADD_COMPONENT 2u
+
+typedef struct WjMockCommand {
+    uint32_t kind;
+    WjEntityId entity;
+    WjComponentTypeId type;
+    const void* data;
+    size_t size;
+} WjMockCommand;
+
+WjCommandBuffer* wj_mock_commands_create(WjApp* app);
+void wj_mock_commands_destroy(WjCommandBuffer* cmds);
+size_t wj_mock_commands_drain(WjCommandBuffer* cmds, WjMockCommand* out,
+                              size_t capacity);
+size_t wj_mock_commands_apply(WjApp* app, WjCommandBuffer* cmds);
+uint64_t wj_mock_entities_spawned(WjApp* app);
+
+/* Total sprite instances committed across all frames */
+uint64_t wj_mock_sprites_committed(WjApp* app);
+
+/* Total bytes submitted through the staging ring */
+uint64_t wj_mock_staging_uploaded(WjApp* app);
+
+/* Engine-side drain of the deferred log ring (what the background
+ * logging thread does); returns records copied */
+size_t wj_mock_log_drain(WjApp* app, WjLogRecord* out, size_t capacity);
+
+/* Reference renderer for a drained record: resolves the interned
+ * format and substitutes the argument words. Returns bytes written
+ * (always NUL-terminates when size > 0). */
+size_t wj_mock_log_format(WjApp* app, const WjLogRecord* rec,
+                          char* buf, size_t size);
+
+/* Profiling introspection: zones entered so far, and the calling
+ * thread's current nesting depth (0 when balanced) */
+uint64_t wj_mock_profile_zone_count(WjApp* app);
+int wj_mock_profile_zone_depth(WjApp* app);
+
+/* The two dispatch styles the FFI benchmarks compare: one boundary
+ * crossing per element versus one crossing for a whole batch. Both do
+ * the same trivial per-element work. */
+void wj_mock_process_one(WjApp* app, WjEntityId id);
+void wj_mock_process_batch(WjApp* app, const WjEntityId* ids, size_t count);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* WINDJAMMER_TESTING_MOCK_HOST_H */
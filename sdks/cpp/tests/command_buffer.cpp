@@ -0,0 +1,81 @@
+// Command buffer: structural changes are recorded, not applied —
+// payloads copy into the frame arena and everything lands at one sync
+// point.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "command_buffer: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+struct Health {
+    int32_t current, max;
+};
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    WjCommandBuffer* raw_cmds = wj_mock_commands_create(raw);
+    wj::CommandBuffer cmds(raw_cmds);
+
+    // A spawn burst: provisional ids come back immediately and feed
+    // later commands in the same frame
+    WjEntityId first = cmds.spawn();
+    require(first & WJ_ENTITY_PROVISIONAL_BIT, "spawn yields a provisional id");
+
+    Health h = {100, 100};
+    require(cmds.add_component(first, WJ_COMPONENT_TRANSFORM, h),
+            "component attaches to a provisional entity");
+    h.current = 1;  // the recorded payload must be a copy, not a reference
+    cmds.despawn(42);
+
+    for (int i = 0; i < 5000; i++) {
+        WjEntityId e = cmds.spawn();
+        require(e != first && (e & WJ_ENTITY_PROVISIONAL_BIT),
+                "provisional ids are distinct");
+    }
+
+    // Engine-side view before the sync point: order preserved, payload
+    // bytes captured at record time
+    WjMockCommand view[4];
+    require(wj_mock_commands_drain(raw_cmds, view, 4) == 4, "commands recorded");
+    require(view[0].kind == WJ_MOCK_CMD_SPAWN && view[0].entity == first,
+            "spawn recorded first");
+    require(view[1].kind == WJ_MOCK_CMD_ADD_COMPONENT &&
+                view[1].size == sizeof(Health),
+            "component payload recorded");
+    Health stored;
+    std::memcpy(&stored, view[1].data, sizeof(stored));
+    require(stored.current == 100, "payload copied at record time");
+    require(view[2].kind == WJ_MOCK_CMD_DESPAWN && view[2].entity == 42,
+            "despawn recorded");
+
+    // The sync point applies everything in one pass and resets the
+    // buffer for the next frame
+    require(wj_mock_commands_apply(raw, raw_cmds) == 5003, "all commands applied");
+    require(wj_mock_entities_spawned(raw) == 5001, "spawns materialized");
+    require(wj_mock_commands_drain(raw_cmds, view, 4) == 0, "buffer reset");
+
+    // Oversized payloads fail cleanly when the frame arena is exhausted
+    static char huge[32u << 20];
+    require(!wj_cmd_add_component(raw_cmds, first, WJ_COMPONENT_TRANSFORM,
+                                  huge, sizeof(huge)),
+            "arena exhaustion reported");
+
+    wj_mock_commands_destroy(raw_cmds);
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,76 @@
+// Coroutine tasks over engine futures (C++20): suspension on pending
+// futures, resumption when the mock completes them, task chaining by
+// symmetric transfer, and no polling in between.
+
+#include <windjammer/wj_task.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "coroutine_task: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+std::string g_trace;
+
+wj::Task<int> fetch_asset_size(wj::App app) {
+    g_trace += "fetch:begin ";
+    co_await wj::await_asset(app, "levels/forest.pack");  // ready: no suspend
+    g_trace += "fetch:loaded ";
+    co_return 1337;
+}
+
+wj::Task<void> level_flow(wj::App app) {
+    int size = co_await fetch_asset_size(app);
+    require(size == 1337, "chained task result");
+
+    g_trace += "flow:fence ";
+    co_await wj::await_frame(app, 2);  // pending: suspends here
+
+    g_trace += "flow:timer ";
+    co_await wj::await_timer(app, 1000000);  // pending: suspends again
+
+    g_trace += "flow:done ";
+}
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    wj::Task<void> task = level_flow(app);
+    require(!task.done(), "lazy until started");
+    require(g_trace.empty(), "no work before start");
+
+    task.start();  // runs until the frame fence
+    require(g_trace == "fetch:begin fetch:loaded flow:fence ", "ran to fence");
+    require(!task.done(), "suspended on fence");
+
+    wj_mock_frame_end(raw);  // frame 1: fence not reached
+    require(!task.done(), "still pending at frame 1");
+
+    wj_mock_frame_end(raw);  // frame 2: fence fires, task runs to timer
+    require(g_trace == "fetch:begin fetch:loaded flow:fence flow:timer ",
+            "resumed by fence");
+
+    wj_mock_advance_time(raw, 500000);  // not yet
+    require(!task.done(), "timer still pending");
+
+    wj_mock_advance_time(raw, 600000);  // timer fires
+    require(task.done(), "completed");
+    require(g_trace == "fetch:begin fetch:loaded flow:fence flow:timer flow:done ",
+            "straight-line order");
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,76 @@
+// Deferred logging: the hot path hands over an interned format id plus
+// raw argument words; formatting happens at drain time, off-thread in a
+// real engine.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "deferred_log: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    // Every placeholder form, through the typed wrapper
+    WjStrId fmt = app.intern("frame {} took {f} ms (flags {x}, zone {s})");
+    WjStrId zone = app.intern("physics");
+    app.log(WJ_LOG_INFO, fmt, (uint64_t)120, 4.5, (uint64_t)0xBEEF);
+    // The wrapper caps at WJ_LOG_MAX_ARGS words; {s} gets its own record
+    app.log(WJ_LOG_DEBUG, app.intern("zone {s} done"), zone);
+    app.log(WJ_LOG_WARN, app.intern("dropped {d} events"), (int64_t)-3);
+
+    // Nothing was formatted yet: records carry ids and raw words only
+    WjLogRecord records[8];
+    size_t n = wj_mock_log_drain(raw, records, 8);
+    require(n == 3, "three records queued");
+    require(records[0].level == WJ_LOG_INFO && records[0].format == fmt,
+            "record carries level and format id");
+    require(records[0].args[0] == 120, "raw words pass through");
+
+    char line[256];
+    wj_mock_log_format(raw, &records[0], line, sizeof(line));
+    require(std::strcmp(line, "frame 120 took 4.5 ms (flags 0xbeef, zone {s})") == 0,
+            "formatter renders decimal, double, hex; extra placeholder left");
+    wj_mock_log_format(raw, &records[1], line, sizeof(line));
+    require(std::strcmp(line, "zone physics done") == 0,
+            "{s} resolves an interned id");
+    wj_mock_log_format(raw, &records[2], line, sizeof(line));
+    require(std::strcmp(line, "dropped -3 events") == 0, "{d} is signed");
+
+    require(wj_mock_log_drain(raw, records, 8) == 0, "ring drained");
+
+    // WJ_LOG caches the interned format per call site
+    for (int i = 0; i < 2; i++) {
+        WJ_LOG(app, WJ_LOG_TRACE, "tick {}", (uint64_t)i);
+    }
+    n = wj_mock_log_drain(raw, records, 8);
+    require(n == 2 && records[0].format == records[1].format,
+            "macro reuses one interned id across calls");
+
+    // A full ring drops rather than blocking the caller
+    WjStrId spam = app.intern("spam");
+    for (int i = 0; i < 5000; i++) {
+        wj_log(raw, WJ_LOG_TRACE, spam, nullptr, 0);
+    }
+    size_t total = 0;
+    while ((n = wj_mock_log_drain(raw, records, 8)) > 0) total += n;
+    require(total <= 1024, "full ring drops instead of blocking");
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
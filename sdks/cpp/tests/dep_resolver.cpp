@@ -0,0 +1,122 @@
+// Constraint compilation, load-order resolution, and the persistent
+// cache that lets an unchanged deployment skip resolution on restart.
+
+#include <windjammer/wj_resolver.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "dep_resolver: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+bool matches(const char* constraint, const char* version) {
+    return wj::constraint_matches(wj::compile_constraint(constraint),
+                                  wj::parse_version(version));
+}
+
+}  // namespace
+
+// Constraint forms compile at compile time
+static_assert(wj::constraint_matches(wj::compile_constraint("^1.0.0"),
+                                     wj::parse_version("1.9.3")),
+              "caret admits same-major upgrades");
+static_assert(!wj::constraint_matches(wj::compile_constraint("^1.0.0"),
+                                      wj::parse_version("2.0.0")),
+              "caret stops at the next major");
+static_assert(!wj::constraint_matches(wj::compile_constraint("^0.2.3"),
+                                      wj::parse_version("0.3.0")),
+              "caret on 0.x stops at the next minor");
+
+int main() {
+    // Packed versions order numerically, not lexically
+    require(wj::parse_version("1.10.0") > wj::parse_version("1.9.9"),
+            "numeric ordering");
+    require(wj::parse_version("1.2") == wj::kVersionInvalid, "two parts rejected");
+    require(wj::parse_version("1.2.3.4") == wj::kVersionInvalid,
+            "four parts rejected");
+
+    // Semver 0.x caret: the leftmost nonzero part is the breaking one
+    require(matches("^0.2.3", "0.2.9"), "0.x caret admits patch bumps");
+    require(!matches("^0.2.3", "0.3.0"), "0.x caret stops at next minor");
+    require(!matches("^0.2.3", "0.9.9"), "0.x caret rejects later minors");
+    require(matches("^0.0.3", "0.0.3") && !matches("^0.0.3", "0.0.4"),
+            "0.0.x caret pins the exact patch");
+
+    require(matches("~1.2.3", "1.2.9"), "tilde admits patch bumps");
+    require(!matches("~1.2.3", "1.3.0"), "tilde stops at next minor");
+    require(matches(">=1.2.3", "7.0.0"), "floor is open above");
+    require(!matches(">=1.2.3", "1.2.2"), "floor rejects below");
+    require(matches("1.2.3", "1.2.3") && !matches("1.2.3", "1.2.4"), "exact");
+    require(matches("*", "0.0.1"), "wildcard");
+    require(!matches("banana", "1.0.0"), "malformed constraint matches nothing");
+
+    // physics -> core, renderer -> {core, physics}; valid order is
+    // core, physics, renderer
+    WjPluginDependency physics_deps[] = {{"core", "^1.0.0"}};
+    WjPluginDependency renderer_deps[] = {{"core", "^1.0.0"},
+                                          {"physics", "~2.1.0"}};
+    wj::ResolverPlugin plugins[] = {
+        {"renderer", "3.0.0", renderer_deps, 2},
+        {"core", "1.4.2", nullptr, 0},
+        {"physics", "2.1.7", physics_deps, 1},
+    };
+
+    std::vector<uint32_t> order;
+    require(wj::resolve_load_order(plugins, 3, &order), "solvable set resolves");
+    require(order.size() == 3, "order covers the set");
+    std::vector<uint32_t> position(3);
+    for (uint32_t i = 0; i < 3; i++) position[order[i]] = i;
+    require(position[1] < position[2], "core loads before physics");
+    require(position[2] < position[0], "physics loads before renderer");
+
+    // Failure modes: unsatisfied constraint, missing plugin, cycle
+    plugins[2].version = "3.0.0";  // physics outside renderer's ~2.1.0
+    require(!wj::resolve_load_order(plugins, 3, &order), "constraint miss fails");
+    plugins[2].version = "2.1.7";
+    require(!wj::resolve_load_order(plugins, 2, &order), "missing dep fails");
+    WjPluginDependency core_deps[] = {{"renderer", "*"}};
+    plugins[1].deps = core_deps;
+    plugins[1].dep_count = 1;
+    require(!wj::resolve_load_order(plugins, 3, &order), "cycle fails");
+    plugins[1].deps = nullptr;
+    plugins[1].dep_count = 0;
+
+    // Cold cache solves and warms; warm cache returns the same order.
+    // Poison the cached order to prove the hit path did not re-solve.
+    wj::ResolverCache cache;
+    std::vector<uint32_t> first, second;
+    require(wj::resolve_cached(plugins, 3, &cache, &first), "cold resolve");
+    require(cache.set_hash != 0 && cache.order == first, "cache warmed");
+    std::swap(cache.order[0], cache.order[1]);
+    require(wj::resolve_cached(plugins, 3, &cache, &second), "warm resolve");
+    require(second == cache.order && second != first,
+            "warm hit served from cache, not re-solved");
+    std::swap(cache.order[0], cache.order[1]);
+
+    // Any change to the set misses the hash and forces a fresh solve
+    plugins[1].version = "1.5.0";
+    require(wj::resolve_cached(plugins, 3, &cache, &second), "changed set");
+    require(second == first, "fresh solve after upgrade");
+
+    // Cache round-trips through its serialized form; garbage is rejected
+    std::vector<char> bytes = wj::write_resolver_cache(cache);
+    wj::ResolverCache loaded;
+    require(wj::read_resolver_cache(bytes.data(), bytes.size(), &loaded),
+            "cache reads back");
+    require(loaded.set_hash == cache.set_hash && loaded.order == cache.order,
+            "cache round-trip");
+    require(!wj::read_resolver_cache(bytes.data(), sizeof(uint32_t), &loaded),
+            "truncated cache rejected");
+    bytes[0] ^= 0xFF;
+    require(!wj::read_resolver_cache(bytes.data(), bytes.size(), &loaded),
+            "bad magic rejected");
+
+    std::printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,52 @@
+// Structured error records: set/get round trip, clear-on-read, and
+// per-thread isolation.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "error_record: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    WjErrorRecord rec;
+    require(!app.last_error(&rec), "clean at start");
+
+    WjStrId source = app.intern("broadphase");
+    app.set_error(42, source, 1001, -7);
+
+    require(app.last_error(&rec), "error retrievable");
+    require(rec.code == 42, "code");
+    require(rec.source == source, "source id");
+    require(rec.arg0 == 1001 && rec.arg1 == -7, "args");
+    require(!app.last_error(&rec), "cleared after read");
+
+    // Later set overwrites the record (one slot per thread)
+    app.set_error(1, source, 0, 0);
+    app.set_error(2, source, 9, 9);
+    require(app.last_error(&rec) && rec.code == 2, "last write wins");
+
+    // Records are per-thread: another thread's error is invisible here
+    std::thread t([&] { app.set_error(99, source, 0, 0); });
+    t.join();
+    require(!app.last_error(&rec), "thread isolation");
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
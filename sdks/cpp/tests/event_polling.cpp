@@ -0,0 +1,73 @@
+// Engine-to-plugin event polling: fixed-layout records, bulk copies,
+// leftover events surviving to the next poll.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "event_polling: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+}  // namespace
+
+// The layout contract the vectorized consumers rely on
+static_assert(sizeof(WjEngineEvent) == 32, "inbound event record is 32 bytes");
+static_assert(alignof(WjEngineEvent) == 16, "inbound event record aligns to 16");
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    require(app.poll_events(nullptr, 0) == 0, "empty poll is harmless");
+
+    // Inject a frame's worth of mixed events
+    WjStrId keyboard = app.intern("keyboard0");
+    constexpr size_t kTotal = 1000;
+    {
+        WjEngineEvent batch[kTotal];
+        for (size_t i = 0; i < kTotal; i++) {
+            batch[i] = {};
+            batch[i].type = (i % 4 == 0) ? WJ_EVENT_COLLISION : WJ_EVENT_INPUT;
+            batch[i].subject = keyboard;
+            batch[i].entity = i;
+            batch[i].payload[0] = i * 2;
+        }
+        require(wj_mock_events_inject(raw, batch, kTotal) == kTotal,
+                "all events injected");
+    }
+
+    // One bulk poll drains into the plugin's buffer; order preserved
+    alignas(16) WjEngineEvent events[640];
+    size_t n = app.poll_events(events, 640);
+    require(n == 640, "poll fills the buffer");
+    require(events[0].entity == 0 && events[639].entity == 639,
+            "order preserved");
+    require(events[1].subject == keyboard && events[1].payload[0] == 2,
+            "record fields intact");
+
+    // The branch-free scan the uniform layout is for
+    size_t collisions = 0;
+    for (size_t i = 0; i < n; i++) {
+        collisions += (events[i].type == WJ_EVENT_COLLISION) ? 1 : 0;
+    }
+    require(collisions == 160, "type-id scan counts collisions");
+
+    // Events that did not fit stay queued for the next poll
+    n = app.poll_events(events, 640);
+    require(n == kTotal - 640, "leftover events survive");
+    require(events[0].entity == 640, "resume where the last poll stopped");
+    require(app.poll_events(events, 640) == 0, "queue exhausted");
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
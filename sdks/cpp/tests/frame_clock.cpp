@@ -0,0 +1,69 @@
+// Frame clock and tick counter: time reads are plain loads, tick
+// intervals convert through the engine's calibrated frequency.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "frame_clock: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    // Fetch once; the pointer is stable and the engine rewrites the
+    // fields at each frame start
+    const WjFrameClock* clock = app.frame_clock();
+    require(clock != nullptr, "clock exported");
+    require(clock == app.frame_clock(), "pointer stable");
+    require(clock->frame == 0 && clock->time_seconds == 0.0, "starts at zero");
+
+    wj_mock_advance_time(raw, 16000000);  // 16 ms
+    wj_mock_frame_end(raw);
+    require(clock->frame == 1, "frame advances");
+    require(clock->frame_start_ns == 16000000, "frame start published");
+    require(clock->delta_seconds > 0.0159f && clock->delta_seconds < 0.0161f,
+            "delta is the previous frame's duration");
+    require(clock->time_seconds > 0.0159 && clock->time_seconds < 0.0161,
+            "absolute time tracks");
+
+    wj_mock_advance_time(raw, 4000000);  // a fast 4 ms frame
+    wj_mock_frame_end(raw);
+    require(clock->frame == 2 && clock->delta_seconds < 0.005f,
+            "per-frame delta updates");
+
+    // Tick counter: monotone, and calibrated conversion lands in the
+    // right order of magnitude for a measured wait
+    uint64_t t0 = wj_ticks();
+    uint64_t t1 = wj_ticks();
+    if (t1 != 0) {  // 0 means no cheap counter on this platform
+        require(t1 >= t0, "ticks are monotone");
+
+        using steady = std::chrono::steady_clock;
+        uint64_t begin = wj_ticks();
+        steady::time_point c0 = steady::now();
+        while (steady::now() - c0 < std::chrono::milliseconds(5)) {
+        }
+        uint64_t ns = app.ticks_to_ns(wj_ticks() - begin);
+        // Loose bounds: scheduling noise, but never off by 10x
+        require(ns > 2000000 && ns < 50000000,
+                "calibrated conversion is in range for a 5 ms wait");
+    }
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
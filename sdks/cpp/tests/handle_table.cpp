@@ -0,0 +1,65 @@
+// Generational handle semantics: resolve, staleness after free, slot
+// reuse bumping the generation, and relocation via the table.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "handle_table: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+struct Body {
+    float mass;
+};
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    Body a = {10.0f};
+    Body b = {20.0f};
+
+    wj::Handle<Body> ha(wj_mock_handle_alloc(raw, &a));
+    wj::Handle<Body> hb(wj_mock_handle_alloc(raw, &b));
+    require(ha && hb && ha != hb, "distinct handles");
+
+    require(app.resolve(ha) == &a, "resolve a");
+    require(app.resolve(hb) == &b, "resolve b");
+    require(app.resolve(ha)->mass == 10.0f, "typed access");
+    require(ha.valid(raw), "valid");
+
+    // Destroy a: its handle goes stale, fails fast instead of dangling
+    wj_mock_handle_free(raw, ha.raw());
+    require(app.resolve(ha) == nullptr, "stale resolves to null");
+    require(!ha.valid(raw), "stale invalid");
+    require(app.resolve(hb) == &b, "b unaffected");
+
+    // The freed slot is reused with a bumped generation, so the old
+    // handle still cannot reach the new occupant
+    Body c = {30.0f};
+    wj::Handle<Body> hc(wj_mock_handle_alloc(raw, &c));
+    require(hc.index() == ha.index(), "slot reused");
+    require(hc.generation() != ha.generation(), "generation bumped");
+    require(app.resolve(ha) == nullptr, "old handle stays stale");
+    require(app.resolve(hc) == &c, "new handle resolves");
+
+    // Relocation: the engine can move an object and repoint the slot;
+    // every outstanding handle follows without plugin involvement
+    wj_mock_handle_free(raw, hb.raw());
+    require(wj_handle_resolve(raw, WJ_HANDLE_INVALID) == nullptr, "invalid handle");
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,51 @@
+// Interning semantics against the mock host: same string, same id;
+// different strings, different ids; reverse lookup is stable.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "intern: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    WjStrId a = app.intern("assets/textures/grass.png");
+    WjStrId b = app.intern("assets/textures/grass.png");
+    WjStrId c = app.intern("assets/textures/stone.png");
+
+    require(a != WJ_STR_INVALID, "valid id");
+    require(a == b, "identical strings intern to the same id");
+    require(a != c, "distinct strings get distinct ids");
+
+    // Hot-path identity check is an integer compare on stable ids
+    require(app.intern("collision") == app.intern("collision"), "stable");
+
+    const char* back = app.str(a);
+    require(back && std::strcmp(back, "assets/textures/grass.png") == 0,
+            "reverse lookup");
+    require(app.str(WJ_STR_INVALID) == nullptr, "invalid id");
+    require(app.str(9999) == nullptr, "unknown id");
+
+    // Length-delimited interning matches NUL-terminated interning
+    require(wj_intern_len(raw, "collision:extra", 9) == app.intern("collision"),
+            "intern_len");
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
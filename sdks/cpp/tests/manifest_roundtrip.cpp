@@ -0,0 +1,95 @@
+// Round-trips plugin metadata through the binary manifest format and
+// checks the reference reader rejects malformed input.
+
+#include <windjammer/wj_manifest.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "manifest_roundtrip: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+}  // namespace
+
+int main() {
+    WjPluginInfo info = {
+        "physics_plugin",
+        "2.3.1",
+        "Rigid body physics",
+        "Windjammer Team",
+        "MIT",
+        WJ_CATEGORY_PHYSICS,
+        true,
+    };
+    WjPluginDependency deps[] = {
+        {"core_systems", "^1.0.0"},
+        {"math_utils", "^2.1.0"},
+    };
+
+    std::vector<char> bytes = wj::write_manifest(
+        info, WJ_PLUGIN_ABI_VERSION, WJ_PLUGIN_FLAG_THREADSAFE_INIT, deps, 2);
+    require(!bytes.empty(), "write");
+    require(bytes.size() <= wj::kManifestMaxSize, "size bound");
+
+    wj::Manifest m;
+    require(wj::read_manifest(bytes.data(), bytes.size(), &m), "read");
+    require(std::strcmp(m.info.name, "physics_plugin") == 0, "name");
+    require(std::strcmp(m.info.version, "2.3.1") == 0, "version");
+    require(std::strcmp(m.info.license, "MIT") == 0, "license");
+    require(m.info.category == WJ_CATEGORY_PHYSICS, "category");
+    require(m.info.supports_hot_reload, "hot reload flag");
+    require(m.abi_version == WJ_PLUGIN_ABI_VERSION, "abi version");
+    require(m.flags == WJ_PLUGIN_FLAG_THREADSAFE_INIT, "flags");
+    require(m.dependencies.size() == 2, "dep count");
+    require(std::strcmp(m.dependencies[0].name, "core_systems") == 0, "dep name");
+    require(std::strcmp(m.dependencies[1].version, "^2.1.0") == 0, "dep version");
+
+    // No dependencies
+    std::vector<char> solo = wj::write_manifest(info, 1, 0, nullptr, 0);
+    wj::Manifest m2;
+    require(wj::read_manifest(solo.data(), solo.size(), &m2), "read no deps");
+    require(m2.dependencies.empty(), "no deps");
+
+    // Malformed input must be rejected, never trusted
+    wj::Manifest bad;
+    require(!wj::read_manifest(nullptr, 0, &bad), "null");
+    require(!wj::read_manifest(bytes.data(), 10, &bad), "truncated header");
+
+    std::vector<char> corrupt = bytes;
+    corrupt[0] ^= 0xFF;
+    require(!wj::read_manifest(corrupt.data(), corrupt.size(), &bad), "bad magic");
+
+    corrupt = bytes;
+    corrupt[corrupt.size() - 1] = 'x';  // remove final NUL
+    require(!wj::read_manifest(corrupt.data(), corrupt.size(), &bad),
+            "unterminated strtab");
+
+    // Offsets whose uint32 sum wraps back to total_size: the reader must
+    // not let strtab_off + strtab_size overflow past the validation
+    corrupt = bytes;
+    wj::WjManifestHeader wrapped;
+    std::memcpy(&wrapped, corrupt.data(), sizeof(wrapped));
+    wrapped.strtab_off = 0xFFFFF000u;
+    wrapped.strtab_size = wrapped.total_size - wrapped.strtab_off;  // wraps
+    std::memcpy(corrupt.data(), &wrapped, sizeof(wrapped));
+    require(!wj::read_manifest(corrupt.data(), corrupt.size(), &bad),
+            "wrapped strtab offsets");
+
+    // Dependency table may not alias the header
+    corrupt = bytes;
+    std::memcpy(&wrapped, corrupt.data(), sizeof(wrapped));
+    wrapped.deps_off = 0;
+    std::memcpy(corrupt.data(), &wrapped, sizeof(wrapped));
+    require(!wj::read_manifest(corrupt.data(), corrupt.size(), &bad),
+            "deps table inside header");
+
+    std::printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Message bus semantics: topic routing, fan-out to multiple
+// subscribers, batch publish/consume, and bounded-queue overflow.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "message_bus: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    WjStrId collisions = app.intern("physics.collisions");
+    WjStrId spawns = app.intern("gameplay.spawns");
+
+    // The physics->AI pattern: two consumers of one topic, one of another
+    wj::Subscription ai = app.subscribe(collisions, 256);
+    wj::Subscription audio = app.subscribe(collisions, 256);
+    wj::Subscription director = app.subscribe(spawns, 64);
+    require(ai && audio && director, "subscribe");
+
+    // Batch publish: 100 collision messages, one spawn
+    WjMessage batch[101] = {};
+    for (int i = 0; i < 100; i++) {
+        batch[i].topic = collisions;
+        batch[i].subject = (uint64_t)i;
+        batch[i].payload[0] = (uint64_t)(i * 2);
+    }
+    batch[100].topic = spawns;
+    batch[100].subject = 777;
+
+    require(app.publish(batch, 101) == 101, "publish accepted");
+
+    WjMessage got[256];
+    require(ai.consume(got, 256) == 100, "ai fan-out");
+    require(got[0].subject == 0 && got[99].subject == 99, "order preserved");
+    require(got[42].payload[0] == 84, "payload intact");
+
+    require(audio.consume(got, 256) == 100, "audio fan-out");
+    size_t n = director.consume(got, 256);
+    require(n == 1 && got[0].subject == 777, "topic isolation");
+
+    // Bounded: a full subscriber queue drops, never blocks or grows
+    wj::Subscription tiny = app.subscribe(spawns, 4);
+    WjMessage burst[8] = {};
+    for (int i = 0; i < 8; i++) burst[i].topic = spawns;
+    size_t accepted = app.publish(burst, 8);
+    require(accepted < 8, "overflow not silently accepted");
+    require(tiny.consume(got, 256) == 4, "bounded at capacity");
+    require(director.consume(got, 256) == 8, "other subscriber unaffected");
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
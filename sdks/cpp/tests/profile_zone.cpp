@@ -0,0 +1,49 @@
+// Profiling zone semantics: RAII begin/end balance across nesting and
+// early scope exits, and WJ_PROFILE_SCOPE interns its name only once.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "profile_zone: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+void worker(wj::App& app) {
+    WJ_PROFILE_SCOPE(app, "worker");
+    {
+        WJ_PROFILE_SCOPE(app, "inner");
+        require(wj_mock_profile_zone_depth(app.raw()) == 2, "nested depth");
+    }
+    require(wj_mock_profile_zone_depth(app.raw()) == 1, "inner closed");
+}
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    for (int i = 0; i < 3; i++) {
+        worker(app);
+    }
+    require(wj_mock_profile_zone_depth(raw) == 0, "balanced");
+    require(wj_mock_profile_zone_count(raw) == 6, "zone count");
+
+    // The macro caches the interned id per call site: three passes,
+    // still only the two names interned
+    require(app.intern("worker") != WJ_STR_INVALID, "worker interned");
+    require(app.intern("inner") != WJ_STR_INVALID, "inner interned");
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Per-plugin resource accounting: every accounted API bumps its
+// counter, and one stats query answers "who is responsible".
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "resource_accounting: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+void spin_job(void* data, uint32_t worker) {
+    (void)worker;
+    volatile uint64_t sink = 0;
+    for (uint64_t i = 0; i < 2000000; i++) sink += i;
+    *(uint64_t*)data = sink;
+}
+
+}  // namespace
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    WjPluginStats stats;
+    require(app.plugin_stats(&stats), "stats query works");
+    require(stats.arena_bytes == 0 && stats.events_published == 0,
+            "counters start at zero");
+    require(!wj_plugin_stats(raw, (WjStrId)99999, &stats),
+            "unknown plugin rejected");
+
+    // Arena: bytes accumulate across allocations
+    wj::Arena arena = app.frame_arena();
+    arena.alloc<uint8_t>(1000);
+    arena.alloc<uint8_t>(2000);
+    require(app.plugin_stats(&stats) && stats.arena_bytes == 3000,
+            "arena bytes accounted");
+
+    // Events and bus messages both count as published
+    wj::EventQueue queue = app.create_event_queue(64);
+    WjEvent ev = {};
+    queue.push(ev);
+    queue.push(ev);
+    wj::Subscription sub = app.subscribe(app.intern("scores"), 16);
+    require(sub.raw() != nullptr, "subscription created");
+    WjMessage msg = {};
+    msg.topic = app.intern("scores");
+    app.publish(&msg, 1);
+    require(app.plugin_stats(&stats) && stats.events_published == 3,
+            "events and messages accounted");
+
+    // State pool: current holding, decremented on release
+    bool created = false;
+    WjStrId key = app.intern("ai_plugin");
+    wj_state_acquire(raw, key, 512, 16, &created);
+    require(app.plugin_stats(&stats) && stats.state_bytes == 512,
+            "state bytes accounted");
+    wj_state_release(raw, key);
+    require(app.plugin_stats(&stats) && stats.state_bytes == 0,
+            "release decrements");
+
+    // Staging submissions
+    int resource = 0;
+    WjHandle dest = wj_mock_handle_alloc(raw, &resource);
+    WjStagingSlice slice;
+    require(app.acquire_staging(4096, 16, &slice), "staging acquire");
+    app.submit_staging(slice, dest);
+    require(app.plugin_stats(&stats) && stats.staging_bytes == 4096,
+            "staging bytes accounted");
+
+    // Job CPU time: a measurable spin lands in job_cpu_ns
+    uint64_t sink = 0;
+    app.submit(&spin_job, &sink).wait();
+    require(app.plugin_stats(&stats) && stats.job_cpu_ns > 0,
+            "job CPU time accounted");
+    uint64_t after_submit = stats.job_cpu_ns;
+    app.parallel_for(1000, [](size_t, size_t, uint32_t) {});
+    require(app.plugin_stats(&stats) && stats.job_cpu_ns >= after_submit,
+            "parallel_for adds CPU time");
+
+    // Crossings only ever grow, and everything above crossed
+    require(stats.crossings >= 8, "boundary crossings counted");
+
+    wj_mock_handle_free(raw, dest);
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
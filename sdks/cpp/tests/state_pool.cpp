@@ -0,0 +1,100 @@
+// Plugin state pool: stable placement across hot reloads, both through
+// the raw ABI and through a WJ_PLUGIN plugin with kPersistentState.
+
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "state_pool: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+}  // namespace
+
+// A plugin whose state survives hot reload in place: trivially
+// copyable, no pointers, placed in the engine pool
+struct CounterPlugin {
+    static constexpr WjPluginInfo kInfo = {
+        "counter_plugin",
+        "1.0.0",
+        "Pool-resident state demo",
+        "Windjammer Team",
+        "MIT",
+        WJ_CATEGORY_OTHER,
+        true,
+    };
+    static constexpr bool kPersistentState = true;
+
+    uint64_t frames_seen;
+
+    void init(wj::App& app) { (void)app; }
+    void update(wj::App& app, const WjFrameBatch& batch) {
+        (void)app;
+        (void)batch;
+        frames_seen++;
+    }
+    void cleanup(wj::App& app) { (void)app; }
+};
+
+WJ_PLUGIN(CounterPlugin)
+
+int main() {
+    WjApp* raw = wj_mock_app_create();
+    wj::App app(raw);
+
+    // Raw ABI: same key, same address, bytes intact across re-acquire
+    WjStrId key = app.intern("physics_plugin");
+    bool created = false;
+    void* first = wj_state_acquire(raw, key, 256, 64, &created);
+    require(first && created, "first acquire creates");
+    require(((uintptr_t)first & 63) == 0, "alignment honored");
+    *(uint64_t*)first = 0xDEADBEEF;
+
+    void* again = wj_state_acquire(raw, key, 256, 64, &created);
+    require(again == first, "stable address across reload");
+    require(!created, "re-acquire does not recreate");
+    require(*(uint64_t*)again == 0xDEADBEEF, "bytes survive");
+
+    // Size change across a reload is a layout break, not a silent alias
+    require(wj_state_acquire(raw, key, 512, 64, &created) == nullptr,
+            "size conflict rejected");
+
+    // Distinct plugins get distinct slots in the same pool
+    void* other = wj_state_acquire(raw, app.intern("ai_plugin"), 128, 16, &created);
+    require(other && other != first && created, "second plugin slot");
+
+    wj_state_release(raw, key);
+    void* fresh = wj_state_acquire(raw, key, 256, 64, &created);
+    require(fresh && created, "released key re-creates");
+
+    // Through WJ_PLUGIN: load, run, unload, reload — the counter keeps
+    // counting because the state never left the pool
+    const WjPluginVTable* vt = wj_plugin_entry();
+    WjFrameBatch batch = {};
+    require(vt->init(raw) == WJ_OK, "plugin init");
+    vt->update(raw, &batch);
+    vt->update(raw, &batch);
+    require(vt->cleanup(raw) == WJ_OK, "plugin unload");
+
+    require(vt->init(raw) == WJ_OK, "plugin reload");
+    vt->update(raw, &batch);
+    bool state_created = true;
+    CounterPlugin* state = static_cast<CounterPlugin*>(wj_state_acquire(
+        raw, app.intern(CounterPlugin::kInfo.name), sizeof(CounterPlugin),
+        alignof(CounterPlugin), &state_created));
+    require(state && !state_created, "plugin state pooled");
+    require(state->frames_seen == 3, "state survived reload");
+    require(vt->cleanup(raw) == WJ_OK, "final cleanup");
+
+    wj_mock_app_destroy(raw);
+    std::printf("ok\n");
+    return 0;
+}
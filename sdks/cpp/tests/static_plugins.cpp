@@ -0,0 +1,95 @@
+// Static plugin linking: WJ_PLUGIN under -DWJ_STATIC_PLUGINS registers
+// into the in-binary registry instead of exporting wj_plugin_entry, and
+// the host drives the same vtables it would get from the loader.
+
+#define WJ_STATIC_PLUGINS
+#include <windjammer/windjammer.hpp>
+
+#include "../testing/mock_host.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+void require(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "static_plugins: FAILED: %s\n", what);
+        std::exit(1);
+    }
+}
+
+int g_updates = 0;
+
+// Written exactly like a dynamic plugin; only the build flag differs
+struct PhysicsPlugin {
+    static constexpr WjPluginInfo kInfo = {
+        "static_physics",
+        "1.0.0",
+        "Statically-linked physics",
+        "Windjammer Team",
+        "MIT",
+        WJ_CATEGORY_PHYSICS,
+        false,
+    };
+    void init(wj::App& app) { (void)app; }
+    void update(wj::App& app, const WjFrameBatch& batch) {
+        (void)app;
+        (void)batch;
+        g_updates++;
+    }
+    void cleanup(wj::App& app) { (void)app; }
+};
+
+struct AudioPlugin {
+    static constexpr WjPluginInfo kInfo = {
+        "static_audio",
+        "2.1.0",
+        "Statically-linked audio",
+        "Windjammer Team",
+        "MIT",
+        WJ_CATEGORY_AUDIO,
+        false,
+    };
+    void init(wj::App& app) { (void)app; }
+    void cleanup(wj::App& app) { (void)app; }
+};
+
+}  // namespace
+
+WJ_PLUGIN(PhysicsPlugin)           // maps to WJ_STATIC_PLUGIN here
+WJ_STATIC_PLUGIN(AudioPlugin)      // explicit form
+
+int main() {
+    // Both plugins are in the registry with their full metadata
+    size_t count = 0;
+    const WjPluginVTable* physics = nullptr;
+    const WjPluginVTable* audio = nullptr;
+    for (const wj::StaticPluginEntry* e = wj::static_plugins(); e; e = e->next) {
+        WjPluginInfo info = e->vtable->info();
+        if (std::strcmp(info.name, "static_physics") == 0) physics = e->vtable;
+        if (std::strcmp(info.name, "static_audio") == 0) audio = e->vtable;
+        count++;
+    }
+    require(count == 2, "two plugins registered");
+    require(physics && audio, "both plugins found by name");
+    require(physics->abi_version == WJ_PLUGIN_ABI_VERSION, "ABI version set");
+    require(std::strcmp(audio->info().version, "2.1.0") == 0,
+            "metadata matches the dynamic path");
+    require(physics->update != nullptr && audio->update == nullptr,
+            "optional entry points detected per plugin");
+
+    // The host drives static vtables exactly like loaded ones
+    WjApp* raw = wj_mock_app_create();
+    WjFrameBatch batch = {};
+    require(physics->init(raw) == WJ_OK, "init");
+    physics->update(raw, &batch);
+    physics->update(raw, &batch);
+    require(g_updates == 2, "updates ran in-binary");
+    require(physics->cleanup(raw) == WJ_OK, "cleanup");
+    wj_mock_app_destroy(raw);
+
+    std::printf("ok\n");
+    return 0;
+}
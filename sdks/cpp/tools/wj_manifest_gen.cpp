@@ -0,0 +1,70 @@
+// wj-manifest-gen — emits the .wjm binary sidecar for a built plugin.
+//
+// Runs at plugin build time (the one place a dlopen is fine) so the
+// engine never has to load a shared object just to read its metadata:
+//
+//     wj-manifest-gen libmy_plugin.so my_plugin.wjm
+
+#include <windjammer/wj_manifest.hpp>
+
+#include <cstdio>
+#include <vector>
+
+#if defined(_WIN32)
+
+int main() {
+    std::fprintf(stderr, "wj-manifest-gen: not supported on Windows yet\n");
+    return 1;
+}
+
+#else
+
+#include <dlfcn.h>
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: wj-manifest-gen <plugin.so> <out.wjm>\n");
+        return 1;
+    }
+
+    void* lib = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+    if (!lib) {
+        std::fprintf(stderr, "wj-manifest-gen: %s\n", dlerror());
+        return 1;
+    }
+
+    using EntryFn = const WjPluginVTable* (*)(void);
+    EntryFn entry = reinterpret_cast<EntryFn>(dlsym(lib, "wj_plugin_entry"));
+    if (!entry) {
+        std::fprintf(stderr, "wj-manifest-gen: %s exports no wj_plugin_entry\n",
+                     argv[1]);
+        return 1;
+    }
+
+    const WjPluginVTable* vt = entry();
+    WjPluginInfo info = vt->info();
+    size_t dep_count = 0;
+    const WjPluginDependency* deps =
+        vt->dependencies ? vt->dependencies(&dep_count) : nullptr;
+
+    std::vector<char> bytes =
+        wj::write_manifest(info, vt->abi_version, vt->flags, deps, dep_count);
+    if (bytes.empty()) {
+        std::fprintf(stderr, "wj-manifest-gen: metadata exceeds manifest limit\n");
+        return 1;
+    }
+
+    FILE* f = std::fopen(argv[2], "wb");
+    if (!f || std::fwrite(bytes.data(), 1, bytes.size(), f) != bytes.size()) {
+        std::fprintf(stderr, "wj-manifest-gen: cannot write %s\n", argv[2]);
+        if (f) std::fclose(f);
+        return 1;
+    }
+    std::fclose(f);
+
+    std::printf("%s: %zu bytes (%s %s, %zu deps)\n", argv[2], bytes.size(),
+                info.name, info.version, dep_count);
+    return 0;
+}
+
+#endif